@@ -0,0 +1,238 @@
+"""Content-addressed cache of compiled objects shared between device builds.
+
+Every configuration gets its own PlatformIO project, so the framework and the
+esphome core would otherwise be recompiled for each device even though the
+toolchain, flags and sources are identical. The build_cache_hook.py extra script
+prefixes the compile commands with this module (copied into the build directory),
+which hashes the preprocessed source together with the compiler and its flags and
+reuses the object file from a cache directory shared by all configurations.
+
+This file is executed standalone by the PlatformIO build, so it must only depend
+on the standard library.
+"""
+import hashlib
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+from typing import Dict, List, Optional, Tuple
+
+# Bump when the key derivation changes so stale entries are never reused
+CACHE_VERSION = 1
+# Placeholder substituted for the device specific build directories when hashing
+BASE_DIR_PLACEHOLDER = "@ESPHOME_BUILD_DIR@"
+# Flags that make the compiler produce additional outputs we don't track
+UNCACHEABLE_FLAGS = (
+    "-MD",
+    "-MMD",
+    "-MF",
+    "-save-temps",
+    "-fprofile-arcs",
+    "--coverage",
+)
+STAT_HIT = b"h"
+STAT_MISS = b"m"
+STAT_SKIP = b"s"
+
+
+def parse_compile_args(args: List[str]) -> Optional[Tuple[str, List[str]]]:
+    """Find the output file of a single compile-only invocation.
+
+    Returns the object path and the arguments needed to preprocess the source,
+    or None if the command is not cacheable (linking, multiple sources, ...).
+    """
+    if "-c" not in args:
+        return None
+    output = None
+    preprocess_args = []
+    it = iter(args)
+    for arg in it:
+        if arg in UNCACHEABLE_FLAGS or arg.startswith("-MF"):
+            return None
+        if arg == "-o":
+            output = next(it, None)
+            continue
+        if arg.startswith("-o") and len(arg) > 2:
+            output = arg[2:]
+            continue
+        if arg == "-c":
+            preprocess_args.append("-E")
+            continue
+        preprocess_args.append(arg)
+    if output is None:
+        return None
+    return output, preprocess_args
+
+
+def normalize(data: bytes, base_dirs: List[str]) -> bytes:
+    # Longest first so nested build directories are replaced as a whole
+    for base in sorted(base_dirs, key=len, reverse=True):
+        data = data.replace(base.encode(), BASE_DIR_PLACEHOLDER.encode())
+    return data
+
+
+def compiler_identity(compiler: str) -> str:
+    path = shutil.which(compiler) or compiler
+    try:
+        stat = os.stat(path)
+    except OSError:
+        return path
+    return f"{os.path.realpath(path)}:{stat.st_size}:{int(stat.st_mtime)}"
+
+
+def compute_key(
+    compiler: str, args: List[str], preprocessed: bytes, base_dirs: List[str]
+) -> str:
+    hasher = hashlib.sha256()
+    hasher.update(f"v{CACHE_VERSION}\0".encode())
+    hasher.update(compiler_identity(compiler).encode())
+    for arg in args:
+        hasher.update(b"\0")
+        hasher.update(normalize(arg.encode(), base_dirs))
+    hasher.update(b"\0\0")
+    hasher.update(normalize(preprocessed, base_dirs))
+    return hasher.hexdigest()
+
+
+def cache_entry_path(cache_dir: str, key: str) -> str:
+    return os.path.join(cache_dir, key[:2], f"{key}.o")
+
+
+def record_stat(stats_path: Optional[str], stat: bytes) -> None:
+    if not stats_path:
+        return
+    # Single byte O_APPEND writes are atomic, parallel compile jobs share the file
+    try:
+        fd = os.open(stats_path, os.O_WRONLY | os.O_APPEND | os.O_CREAT, 0o644)
+    except OSError:
+        return
+    try:
+        os.write(fd, stat)
+    finally:
+        os.close(fd)
+
+
+def _store(cache_dir: str, key: str, output: str) -> None:
+    entry = cache_entry_path(cache_dir, key)
+    os.makedirs(os.path.dirname(entry), exist_ok=True)
+    # Write to a temporary file first so concurrent builds never see partial objects
+    fd, tmp = tempfile.mkstemp(dir=os.path.dirname(entry), suffix=".tmp")
+    os.close(fd)
+    try:
+        shutil.copyfile(output, tmp)
+        os.replace(tmp, entry)
+    except OSError:
+        if os.path.exists(tmp):
+            os.unlink(tmp)
+
+
+def compile_cached(
+    cache_dir: str,
+    stats_path: Optional[str],
+    base_dirs: List[str],
+    command: List[str],
+) -> int:
+    compiler, args = command[0], command[1:]
+    parsed = parse_compile_args(args)
+    if parsed is None:
+        return subprocess.call(command)
+    output, preprocess_args = parsed
+
+    proc = subprocess.run(
+        [compiler] + preprocess_args,
+        stdout=subprocess.PIPE,
+        stderr=subprocess.DEVNULL,
+        check=False,
+    )
+    if proc.returncode != 0:
+        # Let the real compiler report the error
+        record_stat(stats_path, STAT_SKIP)
+        return subprocess.call(command)
+
+    # The object path contains the per device environment name, leave it out of the
+    # key so identical sources compiled for different devices share one entry
+    key = compute_key(compiler, preprocess_args, proc.stdout, base_dirs)
+    entry = cache_entry_path(cache_dir, key)
+    if os.path.isfile(entry):
+        try:
+            os.makedirs(os.path.dirname(output) or ".", exist_ok=True)
+            shutil.copyfile(entry, output)
+            # Refresh mtime so trimming evicts the least recently used entries
+            os.utime(entry)
+            record_stat(stats_path, STAT_HIT)
+            return 0
+        except OSError:
+            pass
+
+    ret = subprocess.call(command)
+    if ret == 0:
+        _store(cache_dir, key, output)
+        record_stat(stats_path, STAT_MISS)
+    return ret
+
+
+def reset_stats(stats_path: str) -> None:
+    if os.path.isfile(stats_path):
+        os.unlink(stats_path)
+
+
+def read_stats(stats_path: str) -> Dict[str, int]:
+    try:
+        with open(stats_path, "rb") as f_handle:
+            data = f_handle.read()
+    except OSError:
+        data = b""
+    return {
+        "hits": data.count(STAT_HIT),
+        "misses": data.count(STAT_MISS),
+        "uncacheable": data.count(STAT_SKIP),
+    }
+
+
+def trim_cache(cache_dir: str, max_size: int) -> int:
+    """Evict the least recently used entries until the cache fits in max_size bytes.
+
+    Returns the number of removed entries.
+    """
+    entries = []
+    total = 0
+    for root, _, files in os.walk(cache_dir):
+        for name in files:
+            path = os.path.join(root, name)
+            try:
+                stat = os.stat(path)
+            except OSError:
+                continue
+            entries.append((stat.st_mtime, stat.st_size, path))
+            total += stat.st_size
+    removed = 0
+    entries.sort()
+    for _, size, path in entries:
+        if total <= max_size:
+            break
+        try:
+            os.unlink(path)
+        except OSError:
+            continue
+        total -= size
+        removed += 1
+    return removed
+
+
+def main(argv: List[str]) -> int:
+    # Usage: build_cache.py <cache_dir> <stats_path> <base_dirs> -- <compiler> <args...>
+    if len(argv) < 5 or argv[3] != "--":
+        sys.stderr.write("usage: build_cache.py CACHE_DIR STATS BASE_DIRS -- CC ARGS\n")
+        return 2
+    cache_dir, stats_path, base_dirs = argv[:3]
+    return compile_cached(
+        cache_dir,
+        stats_path,
+        [x for x in base_dirs.split(os.pathsep) if x],
+        argv[4:],
+    )
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))
@@ -407,6 +407,8 @@ void APIConnection::light_command(const LightCommandRequest &msg) {
     call.set_flash_length(msg.flash_length);
   if (msg.has_effect)
     call.set_effect(msg.effect);
+  if (msg.streaming)
+    call.set_streaming(true);
   call.perform();
 }
 #endif
@@ -478,13 +480,13 @@ void APIConnection::switch_command(const SwitchCommandRequest &msg) {
 #endif
 
 #ifdef USE_TEXT_SENSOR
-bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, std::string state) {
+bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor, const std::string &state) {
   if (!this->state_subscription_)
     return false;
 
   TextSensorStateResponse resp{};
   resp.key = text_sensor->get_object_id_hash();
-  resp.state = std::move(state);
+  resp.state = state;
   resp.missing_state = !text_sensor->has_state();
   return this->send_text_sensor_state_response(resp);
 }
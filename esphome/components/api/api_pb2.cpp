@@ -1702,6 +1702,10 @@ bool LightCommandRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
       this->has_effect = value.as_bool();
       return true;
     }
+    case 28: {
+      this->streaming = value.as_bool();
+      return true;
+    }
     default:
       return false;
   }
@@ -1790,6 +1794,7 @@ void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(17, this->flash_length);
   buffer.encode_bool(18, this->has_effect);
   buffer.encode_string(19, this->effect);
+  buffer.encode_bool(28, this->streaming);
 }
 #ifdef HAS_PROTO_MESSAGE_DUMP
 void LightCommandRequest::dump_to(std::string &out) const {
@@ -1914,6 +1919,10 @@ void LightCommandRequest::dump_to(std::string &out) const {
   out.append("  effect: ");
   out.append("'").append(this->effect).append("'");
   out.append("\n");
+
+  out.append("  streaming: ");
+  out.append(YESNO(this->streaming));
+  out.append("\n");
   out.append("}");
 }
 #endif
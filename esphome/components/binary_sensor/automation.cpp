@@ -26,10 +26,9 @@ void binary_sensor::MultiClickTrigger::on_state_(bool state) {
       ESP_LOGV(TAG, "Multi Click: Starting multi click action!");
       this->at_index_ = 1;
       if (this->timing_.size() == 1 && evt.max_length == 4294967294UL) {
-        this->set_timeout("trigger", evt.min_length, [this]() { this->trigger_(); });
+        this->start_timer_(TimerAction::TRIGGER, evt.min_length);
       } else {
-        this->schedule_is_valid_(evt.min_length);
-        this->schedule_is_not_valid_(evt.max_length);
+        this->schedule_window_(evt.min_length, evt.max_length);
       }
     } else {
       ESP_LOGV(TAG, "Multi Click: action not started because first level does not match!");
@@ -52,17 +51,14 @@ void binary_sensor::MultiClickTrigger::on_state_(bool state) {
 
   if (evt.max_length != 4294967294UL) {
     ESP_LOGV(TAG, "A i=%u min=%u max=%u", *this->at_index_, evt.min_length, evt.max_length);  // NOLINT
-    this->schedule_is_valid_(evt.min_length);
-    this->schedule_is_not_valid_(evt.max_length);
+    this->schedule_window_(evt.min_length, evt.max_length);
   } else if (*this->at_index_ + 1 != this->timing_.size()) {
     ESP_LOGV(TAG, "B i=%u min=%u", *this->at_index_, evt.min_length);  // NOLINT
-    this->cancel_timeout("is_not_valid");
-    this->schedule_is_valid_(evt.min_length);
+    this->schedule_window_(evt.min_length, {});
   } else {
     ESP_LOGV(TAG, "C i=%u min=%u", *this->at_index_, evt.min_length);  // NOLINT
     this->is_valid_ = false;
-    this->cancel_timeout("is_not_valid");
-    this->set_timeout("trigger", evt.min_length, [this]() { this->trigger_(); });
+    this->start_timer_(TimerAction::TRIGGER, evt.min_length);
   }
 
   *this->at_index_ = *this->at_index_ + 1;
@@ -70,39 +66,70 @@ void binary_sensor::MultiClickTrigger::on_state_(bool state) {
 void binary_sensor::MultiClickTrigger::schedule_cooldown_() {
   ESP_LOGV(TAG, "Multi Click: Invalid length of press, starting cooldown of %u ms...", this->invalid_cooldown_);
   this->is_in_cooldown_ = true;
-  this->set_timeout("cooldown", this->invalid_cooldown_, [this]() {
-    ESP_LOGV(TAG, "Multi Click: Cooldown ended, matching is now enabled again.");
-    this->is_in_cooldown_ = false;
-  });
   this->at_index_.reset();
-  this->cancel_timeout("trigger");
-  this->cancel_timeout("is_valid");
-  this->cancel_timeout("is_not_valid");
+  this->start_timer_(TimerAction::COOLDOWN_END, this->invalid_cooldown_);
 }
-void binary_sensor::MultiClickTrigger::schedule_is_valid_(uint32_t min_length) {
-  if (min_length == 0) {
-    this->is_valid_ = true;
+void binary_sensor::MultiClickTrigger::schedule_window_(uint32_t min_length, optional<uint32_t> max_length) {
+  this->window_start_ = millis();
+  this->window_max_ = max_length;
+  if (min_length != 0) {
+    this->is_valid_ = false;
+    this->start_timer_(TimerAction::IS_VALID, min_length);
     return;
   }
-  this->is_valid_ = false;
-  this->set_timeout("is_valid", min_length, [this]() {
-    ESP_LOGV(TAG, "Multi Click: You can now %s the button.", this->parent_->state ? "RELEASE" : "PRESS");
-    this->is_valid_ = true;
-  });
+  this->is_valid_ = true;
+  if (max_length.has_value()) {
+    this->start_timer_(TimerAction::IS_NOT_VALID, *max_length);
+  } else {
+    this->cancel_timer_();
+  }
 }
-void binary_sensor::MultiClickTrigger::schedule_is_not_valid_(uint32_t max_length) {
-  this->set_timeout("is_not_valid", max_length, [this]() {
-    ESP_LOGV(TAG, "Multi Click: You waited too long to %s.", this->parent_->state ? "RELEASE" : "PRESS");
-    this->is_valid_ = false;
-    this->schedule_cooldown_();
-  });
+void binary_sensor::MultiClickTrigger::start_timer_(TimerAction action, uint32_t delay) {
+  // All timings of a multi click are sequential, so a single timeout slot is enough
+  this->timer_action_ = action;
+  this->set_timeout("timer", delay, [this]() { this->on_timer_(); });
+}
+void binary_sensor::MultiClickTrigger::cancel_timer_() {
+  if (this->timer_action_ == TimerAction::NONE)
+    return;
+  this->timer_action_ = TimerAction::NONE;
+  this->cancel_timeout("timer");
+}
+void binary_sensor::MultiClickTrigger::on_timer_() {
+  TimerAction action = this->timer_action_;
+  this->timer_action_ = TimerAction::NONE;
+  switch (action) {
+    case TimerAction::IS_VALID: {
+      ESP_LOGV(TAG, "Multi Click: You can now %s the button.", this->parent_->state ? "RELEASE" : "PRESS");
+      this->is_valid_ = true;
+      if (this->window_max_.has_value()) {
+        // Measured from the edge that opened the window, not from this (possibly late) timeout
+        uint32_t elapsed = millis() - this->window_start_;
+        uint32_t max_length = *this->window_max_;
+        this->start_timer_(TimerAction::IS_NOT_VALID, max_length > elapsed ? max_length - elapsed : 0);
+      }
+      break;
+    }
+    case TimerAction::IS_NOT_VALID:
+      ESP_LOGV(TAG, "Multi Click: You waited too long to %s.", this->parent_->state ? "RELEASE" : "PRESS");
+      this->is_valid_ = false;
+      this->schedule_cooldown_();
+      break;
+    case TimerAction::TRIGGER:
+      this->trigger_();
+      break;
+    case TimerAction::COOLDOWN_END:
+      ESP_LOGV(TAG, "Multi Click: Cooldown ended, matching is now enabled again.");
+      this->is_in_cooldown_ = false;
+      break;
+    case TimerAction::NONE:
+      break;
+  }
 }
 void binary_sensor::MultiClickTrigger::trigger_() {
   ESP_LOGV(TAG, "Multi Click: Hooray, multi click is valid. Triggering!");
   this->at_index_.reset();
-  this->cancel_timeout("trigger");
-  this->cancel_timeout("is_valid");
-  this->cancel_timeout("is_not_valid");
+  this->cancel_timer_();
   this->trigger();
 }
 
@@ -104,16 +104,33 @@ class MultiClickTrigger : public Trigger<>, public Component {
   void set_invalid_cooldown(uint32_t invalid_cooldown) { this->invalid_cooldown_ = invalid_cooldown; }
 
  protected:
+  /// What the single pending timeout of this trigger does when it fires.
+  enum class TimerAction : uint8_t {
+    NONE,
+    /// Minimum length of the current state reached, the next edge is valid from now on
+    IS_VALID,
+    /// Maximum length of the current state exceeded
+    IS_NOT_VALID,
+    TRIGGER,
+    COOLDOWN_END,
+  };
+
   void on_state_(bool state);
+  void on_timer_();
+  void start_timer_(TimerAction action, uint32_t delay);
+  void cancel_timer_();
   void schedule_cooldown_();
-  void schedule_is_valid_(uint32_t min_length);
-  void schedule_is_not_valid_(uint32_t max_length);
+  /// The current state has to last between min_length and max_length (if set) for the next edge to be valid.
+  void schedule_window_(uint32_t min_length, optional<uint32_t> max_length);
   void trigger_();
 
   BinarySensor *parent_;
   std::vector<MultiClickTriggerEvent> timing_;
   uint32_t invalid_cooldown_{1000};
   optional<size_t> at_index_{};
+  TimerAction timer_action_{TimerAction::NONE};
+  uint32_t window_start_{0};
+  optional<uint32_t> window_max_{};
   bool last_state_{false};
   bool is_in_cooldown_{false};
   bool is_valid_{false};
@@ -1,6 +1,7 @@
 #include "filter.h"
 
 #include "binary_sensor.h"
+#include "esphome/core/hal.h"
 #include <utility>
 
 namespace esphome {
@@ -74,38 +75,66 @@ optional<bool> AutorepeatFilter::new_value(bool value, bool is_initial) {
     if (this->active_timing_ != 0)
       return {};
 
-    this->next_timing_();
+    this->next_timing_(millis());
+    this->arm_timer_();
     return true;
   } else {
-    this->cancel_timeout("TIMING");
-    this->cancel_timeout("ON_OFF");
+    this->cancel_timeout("TIMER");
     this->active_timing_ = 0;
+    this->timing_pending_ = false;
+    this->toggling_ = false;
     return false;
   }
 }
 
-void AutorepeatFilter::next_timing_() {
+void AutorepeatFilter::next_timing_(uint32_t now) {
   // Entering this method
   // 1st time: starts waiting the first delay
   // 2nd time: starts waiting the second delay and starts toggling with the first time_off / _on
   // last time: no delay to start but have to bump the index to reflect the last
-  if (this->active_timing_ < this->timings_.size())
-    this->set_timeout("TIMING", this->timings_[this->active_timing_].delay, [this]() { this->next_timing_(); });
+  this->timing_pending_ = this->active_timing_ < this->timings_.size();
+  if (this->timing_pending_)
+    this->timing_due_ = now + this->timings_[this->active_timing_].delay;
 
   if (this->active_timing_ <= this->timings_.size()) {
     this->active_timing_++;
   }
 
-  if (this->active_timing_ == 2)
-    this->next_value_(false);
+  if (this->active_timing_ == 2) {
+    this->toggling_ = true;
+    this->next_toggle_value_ = false;
+    this->next_value_(now);
+  }
 
   // Leaving this method: if the toggling is started, it has to use [active_timing_ - 2] for the intervals
 }
 
-void AutorepeatFilter::next_value_(bool val) {
+void AutorepeatFilter::next_value_(uint32_t now) {
   const AutorepeatFilterTiming &timing = this->timings_[this->active_timing_ - 2];
+  bool val = this->next_toggle_value_;
   this->output(val, false);  // This is at least the second one so not initial
-  this->set_timeout("ON_OFF", val ? timing.time_on : timing.time_off, [this, val]() { this->next_value_(!val); });
+  this->toggle_due_ = now + (val ? timing.time_on : timing.time_off);
+  this->next_toggle_value_ = !val;
+}
+
+void AutorepeatFilter::arm_timer_() {
+  if (!this->timing_pending_ && !this->toggling_)
+    return;
+  uint32_t due = this->toggling_ ? this->toggle_due_ : this->timing_due_;
+  if (this->timing_pending_ && this->toggling_ && int32_t(this->timing_due_ - this->toggle_due_) < 0)
+    due = this->timing_due_;
+  int32_t delay = int32_t(due - millis());
+  this->set_timeout("TIMER", delay > 0 ? delay : 0, [this]() { this->on_timer_(); });
+}
+
+void AutorepeatFilter::on_timer_() {
+  uint32_t now = millis();
+  // Deadlines advance from when they were due, so a late loop doesn't stretch the intervals
+  if (this->timing_pending_ && int32_t(now - this->timing_due_) >= 0)
+    this->next_timing_(this->timing_due_);
+  if (this->toggling_ && int32_t(now - this->toggle_due_) >= 0)
+    this->next_value_(this->toggle_due_);
+  this->arm_timer_();
 }
 
 float AutorepeatFilter::get_setup_priority() const { return setup_priority::HARDWARE; }
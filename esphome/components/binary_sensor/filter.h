@@ -86,11 +86,19 @@ class AutorepeatFilter : public Filter, public Component {
   float get_setup_priority() const override;
 
  protected:
-  void next_timing_();
-  void next_value_(bool val);
+  void next_timing_(uint32_t now);
+  void next_value_(uint32_t now);
+  /// Both the timing steps and the toggling share one timeout, armed for whichever is due first.
+  void arm_timer_();
+  void on_timer_();
 
   std::vector<AutorepeatFilterTiming> timings_;
+  uint32_t timing_due_{0};
+  uint32_t toggle_due_{0};
   uint8_t active_timing_{0};
+  bool timing_pending_{false};
+  bool toggling_{false};
+  bool next_toggle_value_{false};
 };
 
 class LambdaFilter : public Filter {
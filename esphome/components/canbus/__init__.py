@@ -3,11 +3,13 @@ import esphome.config_validation as cv
 from esphome import automation
 from esphome.core import CORE
 from esphome.const import CONF_ID, CONF_TRIGGER_ID, CONF_DATA
+from .filters import FrameMatch
 
 CODEOWNERS = ["@mvturnho", "@danielschramm"]
 IS_PLATFORM_COMPONENT = True
 
 CONF_CAN_ID = "can_id"
+CONF_CAN_ID_MASK = "can_id_mask"
 CONF_USE_EXTENDED_ID = "use_extended_id"
 CONF_CANBUS_ID = "canbus_id"
 CONF_BIT_RATE = "bit_rate"
@@ -68,6 +70,9 @@ CANBUS_SCHEMA = cv.Schema(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(CanbusTrigger),
                 cv.GenerateID(CONF_CAN_ID): cv.int_range(min=0, max=0x1FFFFFFF),
+                cv.Optional(CONF_CAN_ID_MASK, default=0x1FFFFFFF): cv.int_range(
+                    min=0, max=0x1FFFFFFF
+                ),
                 cv.Optional(CONF_USE_EXTENDED_ID, default=False): cv.boolean,
                 cv.Optional(CONF_ON_FRAME): automation.validate_automation(
                     {
@@ -91,15 +96,28 @@ async def setup_canbus_core_(var, config):
 
     for conf in config.get(CONF_ON_FRAME, []):
         can_id = conf[CONF_CAN_ID]
+        can_id_mask = conf[CONF_CAN_ID_MASK]
         ext_id = conf[CONF_USE_EXTENDED_ID]
         validate_id(can_id, ext_id)
-        trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var, can_id, ext_id)
+        trigger = cg.new_Pvariable(
+            conf[CONF_TRIGGER_ID], var, can_id, can_id_mask, ext_id
+        )
         await cg.register_component(trigger, conf)
         await automation.build_automation(
             trigger, [(cg.std_vector.template(cg.uint8), "x")], conf
         )
 
 
+def frame_matches(config):
+    """The frames the configured on_frame triggers listen to."""
+    return [
+        FrameMatch(
+            conf[CONF_CAN_ID], conf[CONF_CAN_ID_MASK], conf[CONF_USE_EXTENDED_ID]
+        )
+        for conf in config.get(CONF_ON_FRAME, [])
+    ]
+
+
 async def register_canbus(var, config):
     if not CORE.has_id(config[CONF_ID]):
         var = cg.new_Pvariable(config[CONF_ID], var)
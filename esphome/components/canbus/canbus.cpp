@@ -1,6 +1,8 @@
 #include "canbus.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace canbus {
 
@@ -11,7 +13,9 @@ void Canbus::setup() {
   if (!this->setup_internal()) {
     ESP_LOGE(TAG, "setup error!");
     this->mark_failed();
+    return;
   }
+  this->set_interval("stats", 60000, [this]() { this->log_stats_(); });
 }
 
 void Canbus::dump_config() {
@@ -20,6 +24,8 @@ void Canbus::dump_config() {
   } else {
     ESP_LOGCONFIG(TAG, "config standard id=0x%03x", this->can_id_);
   }
+  ESP_LOGCONFIG(TAG, "triggers: %u exact ids, %u masked", (unsigned) this->id_triggers_.size(),
+                (unsigned) this->masked_triggers_.size());
 }
 
 void Canbus::send_data(uint32_t can_id, bool use_extended_id, const std::vector<uint8_t> &data) {
@@ -47,41 +53,76 @@ void Canbus::send_data(uint32_t can_id, bool use_extended_id, const std::vector<
 
 void Canbus::add_trigger(CanbusTrigger *trigger) {
   if (trigger->use_extended_id_) {
-    ESP_LOGVV(TAG, "add trigger for extended canid=0x%08x", trigger->can_id_);
+    ESP_LOGVV(TAG, "add trigger for extended canid=0x%08x mask=0x%08x", trigger->can_id_, trigger->can_mask_);
+  } else {
+    ESP_LOGVV(TAG, "add trigger for std canid=0x%03x mask=0x%03x", trigger->can_id_, trigger->can_mask_);
+  }
+  if (trigger->matches_all_id_bits_()) {
+    this->id_triggers_[trigger_key_(trigger->can_id_, trigger->use_extended_id_)].push_back(trigger);
   } else {
-    ESP_LOGVV(TAG, "add trigger for std canid=0x%03x", trigger->can_id_);
+    this->masked_triggers_.push_back(trigger);
   }
-  this->triggers_.push_back(trigger);
 };
 
 void Canbus::loop() {
   struct CanFrame can_message;
-  // readmessage
-  if (this->read_message(&can_message) == canbus::ERROR_OK) {
-    if (can_message.use_extended_id) {
-      ESP_LOGD(TAG, "received can message extended can_id=0x%x size=%d", can_message.can_id,
-               can_message.can_data_length_code);
-    } else {
-      ESP_LOGD(TAG, "received can message std can_id=0x%x size=%d", can_message.can_id,
-               can_message.can_data_length_code);
-    }
+  uint8_t frames = 0;
+  // Drain everything the controller has buffered, one frame per pass loses frames on a busy bus
+  while (frames < CAN_MAX_FRAMES_PER_LOOP && this->read_message(&can_message) == canbus::ERROR_OK) {
+    frames++;
+    this->dispatch_frame_(can_message);
+  }
+  if (frames == 0)
+    return;
 
-    std::vector<uint8_t> data;
+  this->rx_frames_ += frames;
+  if (frames == CAN_MAX_FRAMES_PER_LOOP && this->frame_pending_())
+    this->overruns_++;
+  this->dropped_frames_ += this->read_dropped_frames_();
+}
 
-    // show data received
-    for (int i = 0; i < can_message.can_data_length_code; i++) {
-      ESP_LOGV(TAG, "  can_message.data[%d]=%02x", i, can_message.data[i]);
-      data.push_back(can_message.data[i]);
+void Canbus::dispatch_frame_(const struct CanFrame &frame) {
+  if (frame.use_extended_id) {
+    ESP_LOGV(TAG, "received can message extended can_id=0x%x size=%d", frame.can_id, frame.can_data_length_code);
+  } else {
+    ESP_LOGV(TAG, "received can message std can_id=0x%x size=%d", frame.can_id, frame.can_data_length_code);
+  }
+  for (int i = 0; i < frame.can_data_length_code; i++) {
+    ESP_LOGVV(TAG, "  can_message.data[%d]=%02x", i, frame.data[i]);
+  }
+
+  // The payload is only copied out of the frame if some trigger wants it
+  std::vector<uint8_t> data;
+  bool has_data = false;
+  auto fire = [&](CanbusTrigger *trigger) {
+    if (!has_data) {
+      data.assign(frame.data, frame.data + std::min(frame.can_data_length_code, CAN_MAX_DATA_LENGTH));
+      has_data = true;
     }
+    trigger->trigger(data);
+  };
 
-    // fire all triggers
-    for (auto *trigger : this->triggers_) {
-      if ((trigger->can_id_ == can_message.can_id) && (trigger->use_extended_id_ == can_message.use_extended_id)) {
-        trigger->trigger(data);
-      }
+  auto it = this->id_triggers_.find(trigger_key_(frame.can_id, frame.use_extended_id));
+  if (it != this->id_triggers_.end()) {
+    for (auto *trigger : it->second)
+      fire(trigger);
+  }
+  for (auto *trigger : this->masked_triggers_) {
+    if (trigger->use_extended_id_ == frame.use_extended_id &&
+        (trigger->can_id_ & trigger->can_mask_) == (frame.can_id & trigger->can_mask_)) {
+      fire(trigger);
     }
   }
 }
 
+void Canbus::log_stats_() {
+  if (this->dropped_frames_ == this->reported_dropped_frames_ && this->overruns_ == this->reported_overruns_)
+    return;
+  ESP_LOGW(TAG, "%u frames received, %u dropped by the controller, %u loop overruns", this->rx_frames_,
+           this->dropped_frames_, this->overruns_);
+  this->reported_dropped_frames_ = this->dropped_frames_;
+  this->reported_overruns_ = this->overruns_;
+}
+
 }  // namespace canbus
 }  // namespace esphome
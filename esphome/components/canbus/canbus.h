@@ -4,6 +4,9 @@
 #include "esphome/core/component.h"
 #include "esphome/core/optional.h"
 
+#include <unordered_map>
+#include <vector>
+
 namespace esphome {
 namespace canbus {
 
@@ -41,6 +44,11 @@ template<typename... Ts> class CanbusSendAction;
 /* CAN payload length definitions according to ISO 11898-1 */
 static const uint8_t CAN_MAX_DATA_LENGTH = 8;
 
+static const uint32_t CAN_STANDARD_ID_MASK = 0x7FF;
+static const uint32_t CAN_EXTENDED_ID_MASK = 0x1FFFFFFF;
+/* Upper bound of frames handled per loop() pass, so a flooded bus can't starve other components */
+static const uint8_t CAN_MAX_FRAMES_PER_LOOP = 32;
+
 /*
 Can Frame describes a normative CAN Frame
 The RTR = Remote Transmission Request is implemented in every CAN controller but rarely used
@@ -69,16 +77,43 @@ class Canbus : public Component {
 
   void add_trigger(CanbusTrigger *trigger);
 
+  /// Frames received since boot.
+  uint32_t get_rx_frames() const { return this->rx_frames_; }
+  /// Frames the controller had to discard because its receive buffers were full.
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+  /// Loop passes that hit CAN_MAX_FRAMES_PER_LOOP with frames still pending.
+  uint32_t get_overruns() const { return this->overruns_; }
+
  protected:
   template<typename... Ts> friend class CanbusSendAction;
-  std::vector<CanbusTrigger *> triggers_{};
+  void dispatch_frame_(const struct CanFrame &frame);
+  void log_stats_();
+
+  /// Triggers matching the complete id, keyed by trigger_key_()
+  std::unordered_map<uint32_t, std::vector<CanbusTrigger *>> id_triggers_{};
+  /// Triggers with a partial id mask, checked against every frame
+  std::vector<CanbusTrigger *> masked_triggers_{};
   uint32_t can_id_;
   bool use_extended_id_;
   CanSpeed bit_rate_;
+  uint32_t rx_frames_{0};
+  uint32_t dropped_frames_{0};
+  uint32_t overruns_{0};
+  uint32_t reported_dropped_frames_{0};
+  uint32_t reported_overruns_{0};
 
   virtual bool setup_internal();
   virtual Error send_message(struct CanFrame *frame);
   virtual Error read_message(struct CanFrame *frame);
+  /// Number of frames lost by the controller since the last call, 0 if the hardware can't tell.
+  virtual uint32_t read_dropped_frames_() { return 0; }
+  /// Whether the controller still holds a received frame, false if the hardware can't tell.
+  virtual bool frame_pending_() { return false; }
+
+  static uint32_t trigger_key_(uint32_t can_id, bool use_extended_id) {
+    // Extended ids only use 29 bits, so the top bit keeps both id spaces apart
+    return use_extended_id ? (can_id | 0x80000000) : can_id;
+  }
 };
 
 template<typename... Ts> class CanbusSendAction : public Action<Ts...>, public Parented<Canbus> {
@@ -120,13 +155,20 @@ class CanbusTrigger : public Trigger<std::vector<uint8_t>>, public Component {
   friend class Canbus;
 
  public:
-  explicit CanbusTrigger(Canbus *parent, const std::uint32_t can_id, const bool use_extended_id)
-      : parent_(parent), can_id_(can_id), use_extended_id_(use_extended_id){};
+  explicit CanbusTrigger(Canbus *parent, const std::uint32_t can_id, const std::uint32_t can_mask,
+                         const bool use_extended_id)
+      : parent_(parent), can_id_(can_id), can_mask_(can_mask), use_extended_id_(use_extended_id){};
   void setup() override { this->parent_->add_trigger(this); }
 
  protected:
+  bool matches_all_id_bits_() const {
+    uint32_t id_bits = this->use_extended_id_ ? CAN_EXTENDED_ID_MASK : CAN_STANDARD_ID_MASK;
+    return (this->can_mask_ & id_bits) == id_bits;
+  }
+
   Canbus *parent_;
   uint32_t can_id_;
+  uint32_t can_mask_;
   bool use_extended_id_;
 };
 
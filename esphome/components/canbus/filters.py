@@ -0,0 +1,166 @@
+"""Hardware acceptance filters derived from the configured on_frame triggers.
+
+CAN controllers compare every identifier on the wire against a few mask/filter
+pairs and drop non-matching frames before they reach the CPU. Canbus::loop
+still matches each trigger in software, so the hardware only has to accept a
+superset of the wanted frames; the goal is to keep that superset small.
+
+Identifiers are handled in the 29 bit extended layout, standard ids occupy the
+upper 11 bits of it just like in the controller registers.
+"""
+from itertools import product
+from typing import List, NamedTuple, Optional, Tuple
+
+STANDARD_ID_MASK = 0x7FF
+EXTENDED_ID_MASK = 0x1FFFFFFF
+STANDARD_ID_SHIFT = 18
+# The MCP2515 applies the low mask bits to the first data bytes of standard frames
+EXTENDED_ONLY_BITS = (1 << STANDARD_ID_SHIFT) - 1
+# Number of filters sharing the first and second MCP2515 mask
+MCP2515_SLOTS = (2, 4)
+# Try every assignment of filters to the two MCP2515 masks up to this many entries
+MAX_EXHAUSTIVE = 10
+
+
+class FrameMatch(NamedTuple):
+    """The frames accepted by one trigger, ids match where can_mask bits are set."""
+
+    can_id: int
+    can_mask: int
+    extended: bool
+
+    @property
+    def value(self) -> int:
+        if self.extended:
+            return self.can_id & self.can_mask & EXTENDED_ID_MASK
+        return (self.can_id & self.can_mask & STANDARD_ID_MASK) << STANDARD_ID_SHIFT
+
+    @property
+    def care(self) -> int:
+        if self.extended:
+            return self.can_mask & EXTENDED_ID_MASK
+        return (self.can_mask & STANDARD_ID_MASK) << STANDARD_ID_SHIFT
+
+
+def _id_bits(extended: bool) -> int:
+    return EXTENDED_ID_MASK if extended else STANDARD_ID_MASK << STANDARD_ID_SHIFT
+
+
+def _distinct(matches: List[FrameMatch], mask: int) -> List[Tuple[int, bool]]:
+    return sorted({(match.value & mask, match.extended) for match in matches})
+
+
+def acceptance(mask: int, filters: List[Tuple[int, bool]]) -> float:
+    """Fraction of the identifier space let through by the given filters."""
+    total = 0.0
+    for _, extended in set(filters):
+        total += 2.0 ** -bin(mask & _id_bits(extended)).count("1")
+    return total
+
+
+def cover(matches: List[FrameMatch], slots: int) -> Tuple[int, List[Tuple[int, bool]]]:
+    """Find one mask and at most `slots` filters accepting all of matches.
+
+    Starts from the bits every trigger cares about and greedily drops the mask
+    bit that merges the most filters until they fit.
+    """
+    mask = EXTENDED_ID_MASK
+    for match in matches:
+        mask &= match.care
+    if not all(match.extended for match in matches):
+        mask &= ~EXTENDED_ONLY_BITS
+    filters = _distinct(matches, mask)
+    while len(filters) > slots:
+        best = None
+        for bit in range(29):
+            if not mask & (1 << bit):
+                continue
+            candidate = _distinct(matches, mask & ~(1 << bit))
+            # Prefer dropping low bits, ids of related frames usually share a prefix
+            if best is None or len(candidate) < len(best[1]):
+                best = (bit, candidate)
+        mask &= ~(1 << best[0])
+        filters = best[1]
+    return mask, filters
+
+
+def _native(value: int, extended: bool) -> int:
+    return value if extended else value >> STANDARD_ID_SHIFT
+
+
+def mcp2515_filters(
+    matches: List[FrameMatch],
+) -> Optional[Tuple[List[Tuple[int, bool]], List[Tuple[int, bool]]]]:
+    """Masks and filters for the MCP2515, or None to keep accepting everything.
+
+    Returns two (mask, extended) pairs and six (id, extended) filters in the
+    controller's native id layout. Filters 0-1 use the first mask, 2-5 the second.
+    """
+    matches = sorted(set(matches))
+    if not matches:
+        return None
+
+    def score(groups):
+        return sum(acceptance(*cover(group, slots)) for group, slots in groups if group)
+
+    if len(matches) <= MAX_EXHAUSTIVE:
+        best = None
+        for assignment in product((0, 1), repeat=len(matches)):
+            groups = [
+                (
+                    [m for m, a in zip(matches, assignment) if a == index],
+                    MCP2515_SLOTS[index],
+                )
+                for index in (0, 1)
+            ]
+            current = score(groups)
+            if best is None or current < best[0]:
+                best = (current, [group for group, _ in groups])
+        groups = best[1]
+    else:
+        mask, filters = cover(matches, sum(MCP2515_SLOTS))
+        groups = [[], []]
+        for match in matches:
+            index = filters.index((match.value & mask, match.extended))
+            groups[0 if index < MCP2515_SLOTS[0] else 1].append(match)
+
+    masks = []
+    result = []
+    for group, slots in zip(groups, MCP2515_SLOTS):
+        if not group:
+            # Accept only a single exact id another filter already lets through
+            first = matches[0]
+            group = [FrameMatch(first.can_id, EXTENDED_ID_MASK, first.extended)]
+            group_mask = _id_bits(first.extended)
+            filters = _distinct(group, group_mask)
+        else:
+            group_mask, filters = cover(group, slots)
+        if group_mask == 0:
+            return None
+        extended = all(match.extended for match in group)
+        masks.append((_native(group_mask, extended), extended))
+        # Unused slots repeat a filter so they don't accept anything extra
+        filters = filters + [filters[0]] * (slots - len(filters))
+        result.extend((_native(value, ext), ext) for value, ext in filters)
+    return masks, result
+
+
+def twai_filter(matches: List[FrameMatch]) -> Optional[Tuple[int, int]]:
+    """Single filter mode acceptance code and mask for the ESP32 TWAI controller.
+
+    Returns None to keep accepting everything, which is also the case when
+    standard and extended triggers are mixed since the register layouts differ.
+    """
+    if not matches:
+        return None
+    extended = matches[0].extended
+    if any(match.extended != extended for match in matches):
+        return None
+    mask, filters = cover(matches, 1)
+    if mask == 0:
+        return None
+    value, _ = filters[0]
+    # Both id layouts start at bit 31 of the acceptance registers, so this shift
+    # places standard ids at bits 31-21 and extended ids at bits 31-3. Set bits in
+    # the TWAI acceptance mask mean "don't care".
+    return value << 3, ~(mask << 3) & 0xFFFFFFFF
@@ -1,7 +1,8 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
-from esphome.const import CONF_ID, CONF_PIN
+from esphome.components import uart
+from esphome.const import CONF_ID, CONF_PIN, CONF_UART_ID
 
 MULTI_CONF = True
 AUTO_LOAD = ["sensor"]
@@ -9,17 +10,27 @@ AUTO_LOAD = ["sensor"]
 dallas_ns = cg.esphome_ns.namespace("dallas")
 DallasComponent = dallas_ns.class_("DallasComponent", cg.PollingComponent)
 
-CONFIG_SCHEMA = cv.Schema(
-    {
-        cv.GenerateID(): cv.declare_id(DallasComponent),
-        cv.Required(CONF_PIN): pins.internal_gpio_output_pin_schema,
-    }
-).extend(cv.polling_component_schema("60s"))
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.GenerateID(): cv.declare_id(DallasComponent),
+            cv.Optional(CONF_PIN): pins.internal_gpio_output_pin_schema,
+            # Time slots generated by the UART hardware instead of bit-banging with interrupts disabled
+            cv.Optional(CONF_UART_ID): cv.use_id(uart.UARTComponent),
+        }
+    ).extend(cv.polling_component_schema("60s")),
+    cv.has_exactly_one_key(CONF_PIN, CONF_UART_ID),
+)
 
 
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
-    pin = await cg.gpio_pin_expression(config[CONF_PIN])
-    cg.add(var.set_pin(pin))
+    if CONF_UART_ID in config:
+        parent = await cg.get_variable(config[CONF_UART_ID])
+        cg.add(var.set_uart_parent(parent))
+        cg.add_define("USE_DALLAS_UART")
+    else:
+        pin = await cg.gpio_pin_expression(config[CONF_PIN])
+        cg.add(var.set_pin(pin))
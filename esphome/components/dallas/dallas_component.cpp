@@ -1,5 +1,6 @@
 #include "dallas_component.h"
 #include "esphome/core/log.h"
+#include <algorithm>
 
 namespace esphome {
 namespace dallas {
@@ -31,8 +32,15 @@ uint16_t DallasTemperatureSensor::millis_to_wait_for_conversion() const {
 void DallasComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up DallasComponent...");
 
-  pin_->setup();
-  one_wire_ = new ESPOneWire(pin_);  // NOLINT(cppcoreguidelines-owning-memory)
+#ifdef USE_DALLAS_UART
+  if (this->uart_ != nullptr) {
+    one_wire_ = new UARTOneWire(this->uart_);  // NOLINT(cppcoreguidelines-owning-memory)
+  } else
+#endif
+  {
+    pin_->setup();
+    one_wire_ = new ESPOneWire(pin_);  // NOLINT(cppcoreguidelines-owning-memory)
+  }
 
   std::vector<uint64_t> raw_sensors;
   raw_sensors = this->one_wire_->search_vec();
@@ -68,7 +76,12 @@ void DallasComponent::setup() {
 }
 void DallasComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "DallasComponent:");
-  LOG_PIN("  Pin: ", this->pin_);
+  if (this->pin_ != nullptr) {
+    LOG_PIN("  Pin: ", this->pin_);
+    ESP_LOGCONFIG(TAG, "  Longest interrupt lock: %u µs", this->one_wire_->get_max_interrupt_lock());
+  } else {
+    ESP_LOGCONFIG(TAG, "  Bus: UART, no interrupt lock");
+  }
   LOG_UPDATE_INTERVAL(this);
 
   if (this->found_sensors_.empty()) {
@@ -97,6 +110,7 @@ void DallasComponent::dump_config() {
 void DallasComponent::register_sensor(DallasTemperatureSensor *sensor) { this->sensors_.push_back(sensor); }
 void DallasComponent::update() {
   this->status_clear_warning();
+  this->one_wire_->reset_interrupt_lock_stats();
 
   bool result;
   if (!this->one_wire_->reset()) {
@@ -113,28 +127,40 @@ void DallasComponent::update() {
     return;
   }
 
-  for (auto *sensor : this->sensors_) {
-    this->set_timeout(sensor->get_address_name(), sensor->millis_to_wait_for_conversion(), [this, sensor] {
-      bool res = sensor->read_scratch_pad();
-
-      if (!res) {
-        ESP_LOGW(TAG, "'%s' - Resetting bus for read failed!", sensor->get_name().c_str());
-        sensor->publish_state(NAN);
-        this->status_set_warning();
-        return;
-      }
-      if (!sensor->check_scratch_pad()) {
-        ESP_LOGW(TAG, "'%s' - Scratch pad checksum invalid!", sensor->get_name().c_str());
-        sensor->publish_state(NAN);
-        this->status_set_warning();
-        return;
-      }
+  uint16_t wait = 0;
+  for (auto *sensor : this->sensors_)
+    wait = std::max(wait, sensor->millis_to_wait_for_conversion());
 
-      float tempc = sensor->get_temp_c();
-      ESP_LOGD(TAG, "'%s': Got Temperature=%.1f°C", sensor->get_name().c_str(), tempc);
-      sensor->publish_state(tempc);
-    });
+  // All sensors convert at the same time, read them one per loop iteration once the slowest one is done
+  this->set_timeout("read", wait, [this] { this->read_sensor_(0); });
+}
+
+void DallasComponent::read_sensor_(size_t index) {
+  if (index >= this->sensors_.size()) {
+    ESP_LOGV(TAG, "Interrupts were disabled for %u µs during the update", this->one_wire_->get_total_interrupt_lock());
+    return;
   }
+  this->defer("read", [this, index] { this->read_sensor_(index + 1); });
+
+  auto *sensor = this->sensors_[index];
+  bool res = sensor->read_scratch_pad();
+
+  if (!res) {
+    ESP_LOGW(TAG, "'%s' - Resetting bus for read failed!", sensor->get_name().c_str());
+    sensor->publish_state(NAN);
+    this->status_set_warning();
+    return;
+  }
+  if (!sensor->check_scratch_pad()) {
+    ESP_LOGW(TAG, "'%s' - Scratch pad checksum invalid!", sensor->get_name().c_str());
+    sensor->publish_state(NAN);
+    this->status_set_warning();
+    return;
+  }
+
+  float tempc = sensor->get_temp_c();
+  ESP_LOGD(TAG, "'%s': Got Temperature=%.1f°C", sensor->get_name().c_str(), tempc);
+  sensor->publish_state(tempc);
 }
 
 void DallasTemperatureSensor::set_address(uint64_t address) { this->address_ = address; }
@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/components/sensor/sensor.h"
 #include "esp_one_wire.h"
+#include "uart_one_wire.h"
 
 namespace esphome {
 namespace dallas {
@@ -12,6 +13,9 @@ class DallasTemperatureSensor;
 class DallasComponent : public PollingComponent {
  public:
   void set_pin(InternalGPIOPin *pin) { pin_ = pin; }
+#ifdef USE_DALLAS_UART
+  void set_uart_parent(uart::UARTComponent *uart) { uart_ = uart; }
+#endif
   void register_sensor(DallasTemperatureSensor *sensor);
 
   void setup() override;
@@ -23,8 +27,14 @@ class DallasComponent : public PollingComponent {
  protected:
   friend DallasTemperatureSensor;
 
-  InternalGPIOPin *pin_;
-  ESPOneWire *one_wire_;
+  /// Read the sensor at index and continue with the next one in the following loop iteration.
+  void read_sensor_(size_t index);
+
+  InternalGPIOPin *pin_{nullptr};
+#ifdef USE_DALLAS_UART
+  uart::UARTComponent *uart_{nullptr};
+#endif
+  OneWireBus *one_wire_;
   std::vector<DallasTemperatureSensor *> sensors_;
   std::vector<uint64_t> found_sensors_;
 };
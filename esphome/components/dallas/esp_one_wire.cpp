@@ -10,12 +10,30 @@ static const char *const TAG = "dallas.one_wire";
 const uint8_t ONE_WIRE_ROM_SELECT = 0x55;
 const int ONE_WIRE_ROM_SEARCH = 0xF0;
 
+/// Disables interrupts while in scope and records for how long on the bus.
+class TimedInterruptLock {
+ public:
+  explicit TimedInterruptLock(ESPOneWire *bus) : bus_(bus), start_(micros()) {}
+  ~TimedInterruptLock() {
+    // Runs before lock_ is released, so this includes everything done in the time slot
+    uint32_t duration = micros() - this->start_;
+    this->bus_->total_interrupt_lock_ += duration;
+    if (duration > this->bus_->max_interrupt_lock_)
+      this->bus_->max_interrupt_lock_ = duration;
+  }
+
+ protected:
+  InterruptLock lock_;
+  ESPOneWire *bus_;
+  uint32_t start_;
+};
+
 ESPOneWire::ESPOneWire(InternalGPIOPin *pin) { pin_ = pin->to_isr(); }
 
 bool HOT IRAM_ATTR ESPOneWire::reset() {
   // See reset here:
   // https://www.maximintegrated.com/en/design/technical-documents/app-notes/1/126.html
-  InterruptLock lock;
+  TimedInterruptLock lock(this);
 
   // Wait for communication to clear (delay G)
   pin_.pin_mode(gpio::FLAG_INPUT | gpio::FLAG_PULLUP);
@@ -45,7 +63,7 @@ bool HOT IRAM_ATTR ESPOneWire::reset() {
 void HOT IRAM_ATTR ESPOneWire::write_bit(bool bit) {
   // See write 1/0 bit here:
   // https://www.maximintegrated.com/en/design/technical-documents/app-notes/1/126.html
-  InterruptLock lock;
+  TimedInterruptLock lock(this);
 
   // drive bus low
   pin_.pin_mode(gpio::FLAG_OUTPUT);
@@ -65,7 +83,7 @@ void HOT IRAM_ATTR ESPOneWire::write_bit(bool bit) {
 bool HOT IRAM_ATTR ESPOneWire::read_bit() {
   // See read bit here:
   // https://www.maximintegrated.com/en/design/technical-documents/app-notes/1/126.html
-  InterruptLock lock;
+  TimedInterruptLock lock(this);
 
   // drive bus low, delay A
   pin_.pin_mode(gpio::FLAG_OUTPUT);
@@ -84,43 +102,43 @@ bool HOT IRAM_ATTR ESPOneWire::read_bit() {
   return r;
 }
 
-void ESPOneWire::write8(uint8_t val) {
+void OneWireBus::write8(uint8_t val) {
   for (uint8_t i = 0; i < 8; i++) {
     this->write_bit(bool((1u << i) & val));
   }
 }
 
-void ESPOneWire::write64(uint64_t val) {
-  for (uint8_t i = 0; i < 64; i++) {
-    this->write_bit(bool((1ULL << i) & val));
+void OneWireBus::write64(uint64_t val) {
+  for (uint8_t i = 0; i < 64; i += 8) {
+    this->write8(uint8_t(val >> i));
   }
 }
 
-uint8_t ESPOneWire::read8() {
+uint8_t OneWireBus::read8() {
   uint8_t ret = 0;
   for (uint8_t i = 0; i < 8; i++) {
     ret |= (uint8_t(this->read_bit()) << i);
   }
   return ret;
 }
-uint64_t ESPOneWire::read64() {
+uint64_t OneWireBus::read64() {
   uint64_t ret = 0;
   for (uint8_t i = 0; i < 8; i++) {
     ret |= (uint64_t(this->read_bit()) << i);
   }
   return ret;
 }
-void ESPOneWire::select(uint64_t address) {
+void OneWireBus::select(uint64_t address) {
   this->write8(ONE_WIRE_ROM_SELECT);
   this->write64(address);
 }
-void ESPOneWire::reset_search() {
+void OneWireBus::reset_search() {
   this->last_discrepancy_ = 0;
   this->last_device_flag_ = false;
   this->last_family_discrepancy_ = 0;
   this->rom_number_ = 0;
 }
-uint64_t ESPOneWire::search() {
+uint64_t OneWireBus::search() {
   if (this->last_device_flag_) {
     return 0u;
   }
@@ -207,7 +225,7 @@ uint64_t ESPOneWire::search() {
 
   return this->rom_number_;
 }
-std::vector<uint64_t> ESPOneWire::search_vec() {
+std::vector<uint64_t> OneWireBus::search_vec() {
   std::vector<uint64_t> res;
 
   this->reset_search();
@@ -217,11 +235,11 @@ std::vector<uint64_t> ESPOneWire::search_vec() {
 
   return res;
 }
-void ESPOneWire::skip() {
+void OneWireBus::skip() {
   this->write8(0xCC);  // skip ROM
 }
 
-uint8_t IRAM_ATTR *ESPOneWire::rom_number8_() { return reinterpret_cast<uint8_t *>(&this->rom_number_); }
+uint8_t IRAM_ATTR *OneWireBus::rom_number8_() { return reinterpret_cast<uint8_t *>(&this->rom_number_); }
 
 }  // namespace dallas
 }  // namespace esphome
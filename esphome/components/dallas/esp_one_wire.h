@@ -9,9 +9,10 @@ namespace dallas {
 extern const uint8_t ONE_WIRE_ROM_SELECT;
 extern const int ONE_WIRE_ROM_SEARCH;
 
-class ESPOneWire {
+/// Transport independent part of the 1-Wire protocol, implementations only have to provide the time slots.
+class OneWireBus {
  public:
-  explicit ESPOneWire(InternalGPIOPin *pin);
+  virtual ~OneWireBus() = default;
 
   /** Reset the bus, should be done before all write operations.
    *
@@ -19,16 +20,16 @@ class ESPOneWire {
    *
    * @return Whether the operation was successful.
    */
-  bool reset();
+  virtual bool reset() = 0;
 
   /// Write a single bit to the bus, takes about 70µs.
-  void write_bit(bool bit);
+  virtual void write_bit(bool bit) = 0;
 
   /// Read a single bit from the bus, takes about 70µs
-  bool read_bit();
+  virtual bool read_bit() = 0;
 
   /// Write a word to the bus. LSB first.
-  void write8(uint8_t val);
+  virtual void write8(uint8_t val);
 
   /// Write a 64 bit unsigned integer to the bus. LSB first.
   void write64(uint64_t val);
@@ -37,7 +38,7 @@ class ESPOneWire {
   void skip();
 
   /// Read an 8 bit word from the bus.
-  uint8_t read8();
+  virtual uint8_t read8();
 
   /// Read an 64-bit unsigned integer from the bus.
   uint64_t read64();
@@ -54,15 +55,37 @@ class ESPOneWire {
   /// Helper that wraps search in a std::vector.
   std::vector<uint64_t> search_vec();
 
+  /// Longest time interrupts were disabled for a single time slot in µs.
+  uint32_t get_max_interrupt_lock() const { return this->max_interrupt_lock_; }
+  /// Total time interrupts were disabled since the last call to reset_interrupt_lock_stats() in µs.
+  uint32_t get_total_interrupt_lock() const { return this->total_interrupt_lock_; }
+  void reset_interrupt_lock_stats() { this->total_interrupt_lock_ = 0; }
+
  protected:
   /// Helper to get the internal 64-bit unsigned rom number as a 8-bit integer pointer.
   inline uint8_t *rom_number8_();
 
-  ISRInternalGPIOPin pin_;
   uint8_t last_discrepancy_{0};
   uint8_t last_family_discrepancy_{0};
   bool last_device_flag_{false};
   uint64_t rom_number_{0};
+  uint32_t max_interrupt_lock_{0};
+  uint32_t total_interrupt_lock_{0};
+};
+
+/// 1-Wire bus bit-banged on a GPIO pin, interrupts are disabled during every time slot.
+class ESPOneWire : public OneWireBus {
+ public:
+  explicit ESPOneWire(InternalGPIOPin *pin);
+
+  bool reset() override;
+  void write_bit(bool bit) override;
+  bool read_bit() override;
+
+ protected:
+  friend class TimedInterruptLock;
+
+  ISRInternalGPIOPin pin_;
 };
 
 }  // namespace dallas
@@ -0,0 +1,87 @@
+#include "uart_one_wire.h"
+
+#ifdef USE_DALLAS_UART
+
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace dallas {
+
+static const char *const TAG = "dallas.uart_one_wire";
+
+static const uint32_t RESET_BAUD_RATE = 9600;
+static const uint32_t SLOT_BAUD_RATE = 115200;
+/// Low for ~500µs at 9600 baud, devices answer with a presence pulse that corrupts the echo.
+static const uint8_t RESET_PULSE = 0xF0;
+/// Only the start bit pulls the bus low, for write 1 and read slots.
+static const uint8_t SLOT_HIGH = 0xFF;
+/// Bus stays low for ~78µs, a write 0 slot.
+static const uint8_t SLOT_LOW = 0x00;
+
+bool UARTOneWire::set_baud_rate_(uint32_t baud_rate) {
+  if (this->baud_rate_ == baud_rate)
+    return true;
+  this->flush();
+  if (!this->parent_->change_baud_rate(baud_rate)) {
+    ESP_LOGE(TAG, "The UART doesn't support changing the baud rate, use a hardware UART");
+    return false;
+  }
+  this->baud_rate_ = baud_rate;
+  return true;
+}
+
+bool UARTOneWire::transfer_(uint8_t *slots, size_t len) {
+  // Drop stale bytes so the echo lines up with the slots
+  uint8_t stale;
+  while (this->available() > 0)
+    this->read_byte(&stale);
+
+  this->write_array(slots, len);
+  return this->read_array(slots, len);
+}
+
+bool UARTOneWire::reset() {
+  if (!this->set_baud_rate_(RESET_BAUD_RATE))
+    return false;
+  uint8_t echo = RESET_PULSE;
+  bool present = this->transfer_(&echo, 1) && echo != RESET_PULSE;
+  return this->set_baud_rate_(SLOT_BAUD_RATE) && present;
+}
+
+void UARTOneWire::write_bit(bool bit) {
+  uint8_t slot = bit ? SLOT_HIGH : SLOT_LOW;
+  this->transfer_(&slot, 1);
+}
+
+bool UARTOneWire::read_bit() {
+  uint8_t slot = SLOT_HIGH;
+  // A device answers 0 by holding the bus low, which clears some of the echoed bits
+  return this->transfer_(&slot, 1) && slot == SLOT_HIGH;
+}
+
+void UARTOneWire::write8(uint8_t val) {
+  uint8_t slots[8];
+  for (uint8_t i = 0; i < 8; i++)
+    slots[i] = (val >> i) & 1 ? SLOT_HIGH : SLOT_LOW;
+  this->transfer_(slots, sizeof(slots));
+}
+
+uint8_t UARTOneWire::read8() {
+  uint8_t slots[8];
+  for (auto &slot : slots)
+    slot = SLOT_HIGH;
+  if (!this->transfer_(slots, sizeof(slots)))
+    return 0xFF;
+
+  uint8_t ret = 0;
+  for (uint8_t i = 0; i < 8; i++) {
+    if (slots[i] == SLOT_HIGH)
+      ret |= 1 << i;
+  }
+  return ret;
+}
+
+}  // namespace dallas
+}  // namespace esphome
+
+#endif  // USE_DALLAS_UART
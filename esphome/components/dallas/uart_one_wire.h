@@ -0,0 +1,40 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DALLAS_UART
+
+#include "esphome/components/uart/uart.h"
+#include "esp_one_wire.h"
+
+namespace esphome {
+namespace dallas {
+
+/** 1-Wire bus driven by a UART, the time slots are generated by the UART hardware.
+ *
+ * TX drives the bus through an open-drain buffer (or a diode) and RX reads the bus back. Every time slot is one
+ * UART character at 115200 baud: its start bit pulls the bus low and the echoed character tells whether a device
+ * kept it low. The reset pulse is a single character at 9600 baud. Interrupts stay enabled all the time.
+ */
+class UARTOneWire : public OneWireBus, public uart::UARTDevice {
+ public:
+  explicit UARTOneWire(uart::UARTComponent *parent) : uart::UARTDevice(parent) {}
+
+  bool reset() override;
+  void write_bit(bool bit) override;
+  bool read_bit() override;
+  void write8(uint8_t val) override;
+  uint8_t read8() override;
+
+ protected:
+  bool set_baud_rate_(uint32_t baud_rate);
+  /// Send one time slot per byte of slots and replace them with what was read back from the bus.
+  bool transfer_(uint8_t *slots, size_t len);
+
+  uint32_t baud_rate_{0};
+};
+
+}  // namespace dallas
+}  // namespace esphome
+
+#endif  // USE_DALLAS_UART
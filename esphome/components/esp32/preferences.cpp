@@ -13,9 +13,12 @@ namespace esp32 {
 
 static const char *const TAG = "esp32.preferences";
 
+class ESP32PreferenceBackend;
+
 struct NVSData {
   std::string key;
   std::vector<uint8_t> data;
+  ESP32PreferenceBackend *backend;
 };
 
 static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -24,6 +27,9 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
  public:
   std::string key;
   uint32_t nvs_handle;
+  /// Data last loaded from NVS or successfully committed to it, unchanged values don't need another write.
+  std::vector<uint8_t> stored_data;
+  bool has_stored_data = false;
   bool save(const uint8_t *data, size_t len) override {
     // try find in pending saves and update that
     for (auto &obj : s_pending_save) {
@@ -32,9 +38,13 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
         return true;
       }
     }
+    if (has_stored_data && stored_data.size() == len && memcmp(stored_data.data(), data, len) == 0)
+      return true;
+
     NVSData save{};
     save.key = key;
     save.data.assign(data, data + len);
+    save.backend = this;
     s_pending_save.emplace_back(save);
     return true;
   }
@@ -66,6 +76,8 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
       ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", key.c_str(), esp_err_to_name(err));
       return false;
     }
+    stored_data.assign(data, data + len);
+    has_stored_data = true;
     return true;
   }
 };
@@ -115,9 +127,11 @@ class ESP32Preferences : public ESPPreferences {
     // goal try write all pending saves even if one fails
     bool any_failed = false;
 
+    std::vector<NVSData> written;
+
     // go through vector from back to front (makes erase easier/more efficient)
     for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
+      auto &save = s_pending_save[i];
       esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
       if (err != 0) {
         ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
@@ -125,6 +139,7 @@ class ESP32Preferences : public ESPPreferences {
         any_failed = true;
         continue;
       }
+      written.push_back(std::move(save));
       s_pending_save.erase(s_pending_save.begin() + i);
     }
 
@@ -135,6 +150,12 @@ class ESP32Preferences : public ESPPreferences {
       return false;
     }
 
+    // Only data that is known to be in NVS lets later identical saves be skipped
+    for (auto &save : written) {
+      save.backend->stored_data = std::move(save.data);
+      save.backend->has_stored_data = true;
+    }
+
     return !any_failed;
   }
 };
@@ -222,7 +222,11 @@ async def to_code(config):
 
 async def register_ble_device(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
-    cg.add(paren.register_listener(var))
+    if CONF_MAC_ADDRESS in config:
+        # Only handed advertisements from this address instead of every one
+        cg.add(paren.register_listener(var, config[CONF_MAC_ADDRESS].as_hex))
+    else:
+        cg.add(paren.register_listener(var))
     return var
 
 
@@ -94,6 +94,13 @@ void ESP32BLETracker::loop() {
         if (listener->parse_device(device))
           found = true;
       }
+      auto it = this->address_listeners_.find(device.address_uint64());
+      if (it != this->address_listeners_.end()) {
+        for (auto *listener : it->second) {
+          if (listener->parse_device(device))
+            found = true;
+        }
+      }
 
       for (auto *client : this->clients_) {
         if (client->parse_device(device)) {
@@ -218,6 +225,10 @@ void ESP32BLETracker::start_scan_(bool first) {
   if (!first) {
     for (auto *listener : this->listeners_)
       listener->on_scan_end();
+    for (auto &entry : this->address_listeners_) {
+      for (auto *listener : entry.second)
+        listener->on_scan_end();
+    }
   }
   this->already_discovered_.clear();
   this->scan_params_.scan_type = this->scan_active_ ? BLE_SCAN_TYPE_ACTIVE : BLE_SCAN_TYPE_PASSIVE;
@@ -711,6 +722,8 @@ void ESP32BLETracker::dump_config() {
   ESP_LOGCONFIG(TAG, "  Scan Interval: %.1f ms", this->scan_interval_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Window: %.1f ms", this->scan_window_ * 0.625f);
   ESP_LOGCONFIG(TAG, "  Scan Type: %s", this->scan_active_ ? "ACTIVE" : "PASSIVE");
+  ESP_LOGCONFIG(TAG, "  Listeners: %u, bound to %u addresses", (unsigned) this->listeners_.size(),
+                (unsigned) this->address_listeners_.size());
 }
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
   const uint64_t address = device.address_uint64();
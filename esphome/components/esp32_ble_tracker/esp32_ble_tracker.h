@@ -8,6 +8,7 @@
 
 #include <string>
 #include <array>
+#include <unordered_map>
 #include <esp_gap_ble_api.h>
 #include <esp_gattc_api.h>
 #include <esp_bt_defs.h>
@@ -182,6 +183,11 @@ class ESP32BLETracker : public Component {
     listener->set_parent(this);
     this->listeners_.push_back(listener);
   }
+  /// Register a listener that is only interested in advertisements from a single address.
+  void register_listener(ESPBTDeviceListener *listener, uint64_t address) {
+    listener->set_parent(this);
+    this->address_listeners_[address].push_back(listener);
+  }
 
   void register_client(ESPBTClient *client);
 
@@ -211,7 +217,10 @@ class ESP32BLETracker : public Component {
 
   /// Vector of addresses that have already been printed in print_bt_device_info
   std::vector<uint64_t> already_discovered_;
+  /// Listeners that get every advertisement.
   std::vector<ESPBTDeviceListener *> listeners_;
+  /// Listeners bound to a single address, looked up once per advertisement.
+  std::unordered_map<uint64_t, std::vector<ESPBTDeviceListener *>> address_listeners_;
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
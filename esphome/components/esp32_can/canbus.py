@@ -4,6 +4,7 @@ from esphome import pins
 from esphome.components import canbus
 from esphome.const import CONF_ID, CONF_RX_PIN, CONF_TX_PIN
 from esphome.components.canbus import CanbusComponent, CanSpeed, CONF_BIT_RATE
+from esphome.components.canbus.filters import twai_filter
 
 CODEOWNERS = ["@Sympatron"]
 DEPENDENCIES = ["esp32"]
@@ -37,3 +38,7 @@ async def to_code(config):
 
     cg.add(var.set_rx(config[CONF_RX_PIN]))
     cg.add(var.set_tx(config[CONF_TX_PIN]))
+
+    acceptance = twai_filter(canbus.frame_matches(config))
+    if acceptance is not None:
+        cg.add(var.set_acceptance_filter(*acceptance))
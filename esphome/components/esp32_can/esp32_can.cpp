@@ -42,7 +42,13 @@ static bool get_bitrate(canbus::CanSpeed bitrate, can_timing_config_t *t_config)
 bool ESP32Can::setup_internal() {
   can_general_config_t g_config =
       CAN_GENERAL_CONFIG_DEFAULT((gpio_num_t) this->tx_, (gpio_num_t) this->rx_, CAN_MODE_NORMAL);
-  can_filter_config_t f_config = CAN_FILTER_CONFIG_ACCEPT_ALL();
+  // The default queue only holds 5 frames, buffer a whole loop() drain worth
+  g_config.rx_queue_len = canbus::CAN_MAX_FRAMES_PER_LOOP;
+  can_filter_config_t f_config = {
+      .acceptance_code = this->acceptance_code_,
+      .acceptance_mask = this->acceptance_mask_,
+      .single_filter = true,
+  };
   can_timing_config_t t_config;
 
   if (!get_bitrate(this->bit_rate_, &t_config)) {
@@ -117,6 +123,20 @@ canbus::Error ESP32Can::read_message(struct canbus::CanFrame *frame) {
   return canbus::ERROR_OK;
 }
 
+uint32_t ESP32Can::read_dropped_frames_() {
+  can_status_info_t info;
+  if (can_get_status_info(&info) != ESP_OK)
+    return 0;
+  uint32_t dropped = info.rx_missed_count - this->rx_missed_count_;
+  this->rx_missed_count_ = info.rx_missed_count;
+  return dropped;
+}
+
+bool ESP32Can::frame_pending_() {
+  can_status_info_t info;
+  return can_get_status_info(&info) == ESP_OK && info.msgs_to_rx != 0;
+}
+
 }  // namespace esp32_can
 }  // namespace esphome
 
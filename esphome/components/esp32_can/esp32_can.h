@@ -12,15 +12,25 @@ class ESP32Can : public canbus::Canbus {
  public:
   void set_rx(int rx) { rx_ = rx; }
   void set_tx(int tx) { tx_ = tx; }
+  /// Single filter mode acceptance code/mask computed from the triggers, accepts all frames if unset.
+  void set_acceptance_filter(uint32_t code, uint32_t mask) {
+    this->acceptance_code_ = code;
+    this->acceptance_mask_ = mask;
+  }
   ESP32Can(){};
 
  protected:
   bool setup_internal() override;
   canbus::Error send_message(struct canbus::CanFrame *frame) override;
   canbus::Error read_message(struct canbus::CanFrame *frame) override;
+  uint32_t read_dropped_frames_() override;
+  bool frame_pending_() override;
 
   int rx_{-1};
   int tx_{-1};
+  uint32_t rx_missed_count_{0};
+  uint32_t acceptance_code_{0};
+  uint32_t acceptance_mask_{0xFFFFFFFF};
 };
 
 }  // namespace esp32_can
@@ -135,6 +135,7 @@ class ESP8266PreferenceBackend : public ESPPreferenceBackend {
       return save_to_rtc(offset, buffer.data(), buffer.size());
     }
   }
+  bool is_written_immediately() const override { return !in_flash; }
   bool load(uint8_t *data, size_t len) override {
     if ((len + 3) / 4 != length_words) {
       return false;
@@ -10,17 +10,21 @@ static const char *const TAG = "integration";
 
 void IntegrationSensor::setup() {
   if (this->restore_) {
-    this->rtc_ = global_preferences->make_preference<float>(this->get_object_id_hash());
     float preference_value = 0;
-    this->rtc_.load(&preference_value);
-    this->result_ = preference_value;
+    this->rtc_.setup(global_preferences->make_preference<float>(this->get_object_id_hash()), this->min_save_interval_,
+                     &preference_value);
+    this->result_.reset(preference_value);
   }
 
   this->last_update_ = millis();
-  this->last_save_ = this->last_update_;
 
-  this->publish_and_save_(this->result_);
-  this->sensor_->add_on_state_callback([this](float state) { this->process_sensor_value_(state); });
+  this->publish_and_save_(this->result_.value());
+  if (this->use_raw_values_) {
+    // Integrate every sample, independent of how often the (filtered) source is published
+    this->sensor_->add_on_raw_state_callback([this](float state) { this->process_sensor_value_(state); });
+  } else {
+    this->sensor_->add_on_state_callback([this](float state) { this->process_sensor_value_(state); });
+  }
 }
 void IntegrationSensor::dump_config() { LOG_SENSOR("", "Integration Sensor", this); }
 void IntegrationSensor::process_sensor_value_(float value) {
@@ -43,7 +47,9 @@ void IntegrationSensor::process_sensor_value_(float value) {
   }
   this->last_value_ = new_value;
   this->last_update_ = now;
-  this->publish_and_save_(this->result_ + area);
+  this->result_.add(area);
+  this->publish_state(this->result_.value());
+  this->rtc_.update(this->result_.value());
 }
 
 }  // namespace integration
@@ -33,6 +33,7 @@ class IntegrationSensor : public sensor::Sensor, public Component {
   void set_time(IntegrationSensorTime time) { time_ = time; }
   void set_method(IntegrationMethod method) { method_ = method; }
   void set_restore(bool restore) { restore_ = restore; }
+  void set_use_raw_values(bool use_raw_values) { use_raw_values_ = use_raw_values; }
   void reset() { this->publish_and_save_(0.0f); }
 
  protected:
@@ -54,26 +55,21 @@ class IntegrationSensor : public sensor::Sensor, public Component {
     }
   }
   void publish_and_save_(double result) {
-    this->result_ = result;
+    this->result_.reset(result);
     this->publish_state(result);
-    float result_f = result;
-    const uint32_t now = millis();
-    if (now - this->last_save_ < this->min_save_interval_)
-      return;
-    this->last_save_ = now;
-    this->rtc_.save(&result_f);
+    this->rtc_.update(result);
   }
 
   sensor::Sensor *sensor_;
   IntegrationSensorTime time_;
   IntegrationMethod method_;
   bool restore_;
-  ESPPreferenceObject rtc_;
+  bool use_raw_values_{false};
+  ThrottledPreference<float> rtc_;
 
-  uint32_t last_save_{0};
   uint32_t min_save_interval_{0};
   uint32_t last_update_;
-  double result_{0.0f};
+  CompensatedSum result_;
   float last_value_{0.0f};
 };
 
@@ -36,6 +36,7 @@ INTEGRATION_METHODS = {
 CONF_TIME_UNIT = "time_unit"
 CONF_INTEGRATION_METHOD = "integration_method"
 CONF_MIN_SAVE_INTERVAL = "min_save_interval"
+CONF_USE_RAW_VALUES = "use_raw_values"
 
 
 def inherit_unit_of_measurement(uom, config):
@@ -61,6 +62,7 @@ CONFIG_SCHEMA = sensor.SENSOR_SCHEMA.extend(
         cv.Optional(
             CONF_MIN_SAVE_INTERVAL, default="0s"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_USE_RAW_VALUES, default=False): cv.boolean,
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -98,6 +100,7 @@ async def to_code(config):
     cg.add(var.set_method(config[CONF_INTEGRATION_METHOD]))
     cg.add(var.set_restore(config[CONF_RESTORE]))
     cg.add(var.set_min_save_interval(config[CONF_MIN_SAVE_INTERVAL]))
+    cg.add(var.set_use_raw_values(config[CONF_USE_RAW_VALUES]))
 
 
 @automation.register_action(
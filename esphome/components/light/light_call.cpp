@@ -30,8 +30,10 @@ static const LogString *color_mode_to_human(ColorMode color_mode) {
 void LightCall::perform() {
   const char *name = this->parent_->get_name().c_str();
   LightColorValues v = this->validate_();
+  // Stream frames come in at up to a few dozen per second, only the final state gets logged
+  const bool log = this->publish_ && !this->streaming_;
 
-  if (this->publish_) {
+  if (log) {
     ESP_LOGD(TAG, "'%s' Setting:", name);
 
     // Only print color mode when it's being changed
@@ -73,20 +75,20 @@ void LightCall::perform() {
 
   if (this->has_flash_()) {
     // FLASH
-    if (this->publish_) {
+    if (log) {
       ESP_LOGD(TAG, "  Flash length: %.1fs", *this->flash_length_ / 1e3f);
     }
 
     this->parent_->start_flash_(v, *this->flash_length_, this->publish_);
   } else if (this->has_transition_()) {
     // TRANSITION
-    if (this->publish_) {
+    if (log) {
       ESP_LOGD(TAG, "  Transition length: %.1fs", *this->transition_length_ / 1e3f);
     }
 
     // Special case: Transition and effect can be set when turning off
     if (this->has_effect_()) {
-      if (this->publish_) {
+      if (log) {
         ESP_LOGD(TAG, "  Effect: 'None'");
       }
       this->parent_->stop_effect_();
@@ -104,7 +106,7 @@ void LightCall::perform() {
       effect_s = this->parent_->effects_[*this->effect_ - 1]->get_name().c_str();
     }
 
-    if (this->publish_) {
+    if (log) {
       ESP_LOGD(TAG, "  Effect: '%s'", effect_s);
     }
 
@@ -121,6 +123,10 @@ void LightCall::perform() {
   if (!this->has_transition_()) {
     this->parent_->target_state_reached_callback_.call();
   }
+  if (this->streaming_) {
+    this->parent_->stream_frame_(this->publish_, this->save_);
+    return;
+  }
   if (this->publish_) {
     this->parent_->publish_state();
   }
@@ -142,7 +148,7 @@ LightColorValues LightCall::validate_() {
 
   // Ensure there is always a color mode set
   if (!this->color_mode_.has_value()) {
-    this->color_mode_ = this->compute_color_mode_();
+    this->color_mode_ = this->streaming_ ? this->get_stream_color_mode_() : this->compute_color_mode_();
   }
   auto color_mode = *this->color_mode_;
 
@@ -298,8 +304,9 @@ LightColorValues LightCall::validate_() {
     this->transition_length_.reset();
   }
 
+  // Stream frames are applied instantly, unless a transition was requested explicitly
   if (!this->has_transition_() && !this->has_flash_() && (!this->has_effect_() || *this->effect_ == 0) &&
-      supports_transition) {
+      supports_transition && !this->streaming_) {
     // nothing specified and light supports transitions, set default transition length
     this->transition_length_ = this->parent_->default_transition_length_;
   }
@@ -344,8 +351,10 @@ void LightCall::transform_parameters_() {
       !(*this->color_mode_ & ColorCapability::WHITE) &&                                                //
       !(*this->color_mode_ & ColorCapability::COLOR_TEMPERATURE) &&                                    //
       traits.get_min_mireds() > 0.0f && traits.get_max_mireds() > 0.0f) {
-    ESP_LOGD(TAG, "'%s' - Setting cold/warm white channels using white/color temperature values.",
-             this->parent_->get_name().c_str());
+    if (!this->streaming_) {
+      ESP_LOGD(TAG, "'%s' - Setting cold/warm white channels using white/color temperature values.",
+               this->parent_->get_name().c_str());
+    }
     auto current_values = this->parent_->remote_values;
     if (this->color_temperature_.has_value()) {
       const float white =
@@ -410,6 +419,27 @@ ColorMode LightCall::compute_color_mode_() {
            this->parent_->get_name().c_str(), LOG_STR_ARG(color_mode_to_human(color_mode)));
   return color_mode;
 }
+ColorMode LightCall::get_stream_color_mode_() {
+  // The color mode only depends on which parameters are set and the current mode, which rarely change during a
+  // stream, so skip recomputing (and logging) it for every frame.
+  bool has_white = this->white_.has_value() && *this->white_ > 0.0f;
+  bool has_ct = this->color_temperature_.has_value();
+  bool has_cwww = (this->cold_white_.has_value() && *this->cold_white_ > 0.0f) ||
+                  (this->warm_white_.has_value() && *this->warm_white_ > 0.0f);
+  bool has_rgb = (this->color_brightness_.has_value() && *this->color_brightness_ > 0.0f) ||
+                 (this->red_.has_value() || this->green_.has_value() || this->blue_.has_value());
+  bool turn_off = this->state_.has_value() && !*this->state_;
+  uint8_t key = has_white << 0 | has_ct << 1 | has_cwww << 2 | has_rgb << 3 | turn_off << 4;
+
+  auto &cache = this->parent_->stream_color_mode_;
+  ColorMode current_mode = this->parent_->remote_values.get_color_mode();
+  if (cache.key != key || cache.current_mode != current_mode) {
+    cache.key = key;
+    cache.current_mode = current_mode;
+    cache.result = this->compute_color_mode_();
+  }
+  return cache.result;
+}
 std::set<ColorMode> LightCall::get_suitable_color_modes_() {
   bool has_white = this->white_.has_value() && *this->white_ > 0.0f;
   bool has_ct = this->color_temperature_.has_value();
@@ -674,6 +704,10 @@ LightCall &LightCall::set_save(bool save) {
   this->save_ = save;
   return *this;
 }
+LightCall &LightCall::set_streaming(bool streaming) {
+  this->streaming_ = streaming;
+  return *this;
+}
 LightCall &LightCall::set_rgb(float red, float green, float blue) {
   this->set_red(red);
   this->set_green(green);
@@ -153,6 +153,12 @@ class LightCall {
    */
   LightCall &set_rgbw(float red, float green, float blue, float white);
   LightCall &from_light_color_values(const LightColorValues &values);
+  /** Mark this call as one frame of a high rate stream, for example from an external controller.
+   *
+   * Stream frames are applied instantly (unless a transition is given explicitly) and skip logging,
+   * publishing and saving the state. The light does that once after the stream has been idle for a second.
+   */
+  LightCall &set_streaming(bool streaming);
 
   void perform();
 
@@ -167,6 +173,8 @@ class LightCall {
   ColorMode compute_color_mode_();
   /// Get potential color modes for this light call.
   std::set<ColorMode> get_suitable_color_modes_();
+  /// Get the color mode for a streamed call, reusing the result of the previous frame if possible.
+  ColorMode get_stream_color_mode_();
   /// Some color modes also can be set using non-native parameters, transform those calls.
   void transform_parameters_();
 
@@ -191,6 +199,7 @@ class LightCall {
   optional<uint32_t> effect_;
   bool publish_{true};
   bool save_{true};
+  bool streaming_{false};
 };
 
 }  // namespace light
@@ -1,3 +1,4 @@
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "light_state.h"
 #include "light_output.h"
@@ -8,6 +9,9 @@ namespace light {
 
 static const char *const TAG = "light";
 
+/// Publish and save the state of a stream of calls after it has been idle this long (in ms).
+static const uint32_t STREAM_IDLE_TIMEOUT = 1000;
+
 LightState::LightState(const std::string &name, LightOutput *output) : EntityBase(name), output_(output) {}
 LightState::LightState(LightOutput *output) : output_(output) {}
 
@@ -136,6 +140,17 @@ void LightState::loop() {
     this->next_write_ = false;
     this->output_->write_state(this);
   }
+
+  // Settle a stream of calls once it went idle
+  if ((this->stream_publish_ || this->stream_save_) && millis() - this->last_stream_frame_ > STREAM_IDLE_TIMEOUT) {
+    ESP_LOGD(TAG, "'%s' Stream ended", this->get_name().c_str());
+    if (this->stream_publish_)
+      this->publish_state();
+    if (this->stream_save_)
+      this->save_remote_values_();
+    this->stream_publish_ = false;
+    this->stream_save_ = false;
+  }
 }
 
 float LightState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
@@ -268,6 +283,11 @@ void LightState::set_immediately_(const LightColorValues &target, bool set_remot
   this->next_write_ = true;
 }
 
+void LightState::stream_frame_(bool publish, bool save) {
+  this->stream_publish_ |= publish;
+  this->stream_save_ |= save;
+  this->last_stream_frame_ = millis();
+}
 void LightState::save_remote_values_() {
   LightStateRTCState saved;
   saved.color_mode = this->remote_values.get_color_mode();
@@ -168,6 +168,10 @@ class LightState : public EntityBase, public Component {
   /// Internal method to save the current remote_values to the preferences
   void save_remote_values_();
 
+  /// Internal method to note a streamed call, the state is published and/or saved (as requested by the calls of the
+  /// stream) once the stream goes idle.
+  void stream_frame_(bool publish, bool save);
+
   /// Store the output to allow effects to have more access.
   LightOutput *output_;
   /// Value for storing the index of the currently active effect. 0 if no effect is active
@@ -176,6 +180,18 @@ class LightState : public EntityBase, public Component {
   std::unique_ptr<LightTransformer> transformer_{nullptr};
   /// Whether the light value should be written in the next cycle.
   bool next_write_{true};
+  /// Whether streamed calls that asked to publish the state were applied since the stream was last settled.
+  bool stream_publish_{false};
+  /// Whether streamed calls that asked to save the state were applied since the stream was last settled.
+  bool stream_save_{false};
+  /// Time of the last streamed call.
+  uint32_t last_stream_frame_{0};
+  /// Color mode chosen for the last streamed call without color mode, keyed by the call's parameters.
+  struct {
+    uint8_t key{0xFF};
+    ColorMode current_mode{ColorMode::UNKNOWN};
+    ColorMode result{ColorMode::UNKNOWN};
+  } stream_color_mode_;
 
   /// Object used to store the persisted values of the light.
   ESPPreferenceObject rtc_;
@@ -1,13 +1,16 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
+from esphome import pins
 from esphome.components import spi, canbus
 from esphome.const import CONF_ID, CONF_MODE
 from esphome.components.canbus import CanbusComponent
+from esphome.components.canbus.filters import mcp2515_filters
 
 CODEOWNERS = ["@mvturnho", "@danielschramm"]
 DEPENDENCIES = ["spi"]
 
 CONF_CLOCK = "clock"
+CONF_INTERRUPT_PIN = "interrupt_pin"
 
 mcp2515_ns = cg.esphome_ns.namespace("mcp2515")
 mcp2515 = mcp2515_ns.class_("MCP2515", CanbusComponent, spi.SPIDevice)
@@ -31,6 +34,7 @@ CONFIG_SCHEMA = canbus.CANBUS_SCHEMA.extend(
         cv.GenerateID(): cv.declare_id(mcp2515),
         cv.Optional(CONF_CLOCK, default="8MHZ"): cv.enum(CAN_CLOCK, upper=True),
         cv.Optional(CONF_MODE, default="NORMAL"): cv.enum(MCP_MODE, upper=True),
+        cv.Optional(CONF_INTERRUPT_PIN): pins.gpio_input_pin_schema,
     }
 ).extend(spi.spi_device_schema(True))
 
@@ -45,5 +49,16 @@ async def to_code(config):
     if CONF_MODE in config:
         mode = MCP_MODE[config[CONF_MODE]]
         cg.add(var.set_mcp_mode(mode))
+    if CONF_INTERRUPT_PIN in config:
+        pin = await cg.gpio_pin_expression(config[CONF_INTERRUPT_PIN])
+        cg.add(var.set_interrupt_pin(pin))
+
+    hardware_filters = mcp2515_filters(canbus.frame_matches(config))
+    if hardware_filters is not None:
+        masks, filters = hardware_filters
+        for num, (mask, extended) in enumerate(masks):
+            cg.add(var.set_filter_mask(num, mask, extended))
+        for num, (can_id, extended) in enumerate(filters):
+            cg.add(var.set_filter(num, can_id, extended))
 
     await spi.register_spi_device(var, config)
@@ -15,15 +15,37 @@ const struct MCP2515::RxBnRegs MCP2515::RXB[N_RXBUFFERS] = {{MCP_RXB0CTRL, MCP_R
 
 bool MCP2515::setup_internal() {
   this->spi_setup();
+  if (this->interrupt_pin_ != nullptr)
+    this->interrupt_pin_->setup();
 
   if (this->reset_() == canbus::ERROR_FAIL)
     return false;
   this->set_bitrate_(this->bit_rate_, this->mcp_clock_);
+  if (this->use_filters_ && this->setup_filters_() != canbus::ERROR_OK)
+    return false;
   this->set_mode_(this->mcp_mode_);
   ESP_LOGV(TAG, "setup done");
   return true;
 }
 
+canbus::Error MCP2515::setup_filters_() {
+  for (uint8_t i = 0; i < 2; i++) {
+    const FilterId &mask = this->filter_masks_[i];
+    canbus::Error res = this->set_filter_mask_(static_cast<MASK>(i), mask.extended, mask.id);
+    if (res != canbus::ERROR_OK)
+      return res;
+    ESP_LOGV(TAG, "mask %u: 0x%08x", i, mask.id);
+  }
+  for (uint8_t i = 0; i < 6; i++) {
+    const FilterId &filter = this->filters_[i];
+    canbus::Error res = this->set_filter_(static_cast<RXF>(i), filter.extended, filter.id);
+    if (res != canbus::ERROR_OK)
+      return res;
+    ESP_LOGV(TAG, "filter %u: %s 0x%08x", i, filter.extended ? "ext" : "std", filter.id);
+  }
+  return canbus::ERROR_OK;
+}
+
 canbus::Error MCP2515::reset_() {
   this->enable();
   this->transfer_byte(INSTRUCTION_RESET);
@@ -305,6 +327,10 @@ canbus::Error MCP2515::read_message_(RXBn rxbn, struct canbus::CanFrame *frame)
 }
 
 canbus::Error MCP2515::read_message(struct canbus::CanFrame *frame) {
+  // INT is active low and asserted as long as a receive buffer is full
+  if (this->interrupt_pin_ != nullptr && this->interrupt_pin_->digital_read())
+    return canbus::ERROR_NOMSG;
+
   canbus::Error rc;
   uint8_t stat = get_status_();
 
@@ -319,6 +345,27 @@ canbus::Error MCP2515::read_message(struct canbus::CanFrame *frame) {
   return rc;
 }
 
+uint32_t MCP2515::read_dropped_frames_() {
+  uint8_t eflg = get_error_flags_();
+  uint32_t dropped = 0;
+  // The controller only flags an overflow per buffer, so this is a lower bound
+  if (eflg & EFLG_RX0OVR)
+    dropped++;
+  if (eflg & EFLG_RX1OVR)
+    dropped++;
+  if (dropped != 0) {
+    clear_rx_n_ovr_flags_();
+    clear_errif_();
+  }
+  return dropped;
+}
+
+bool MCP2515::frame_pending_() {
+  if (this->interrupt_pin_ != nullptr)
+    return !this->interrupt_pin_->digital_read();
+  return this->check_receive_();
+}
+
 bool MCP2515::check_receive_() {
   uint8_t res = get_status_();
   return (res & STAT_RXIF_MASK) != 0;
@@ -59,6 +59,14 @@ class MCP2515 : public canbus::Canbus,
   MCP2515(){};
   void set_mcp_clock(CanClock clock) { this->mcp_clock_ = clock; };
   void set_mcp_mode(const CanctrlReqopMode mode) { this->mcp_mode_ = mode; }
+  /// Optional INT line, lets read_message() skip the SPI status poll while no frame is pending.
+  void set_interrupt_pin(GPIOPin *interrupt_pin) { this->interrupt_pin_ = interrupt_pin; }
+  /// Acceptance masks and filters computed from the triggers, programmed in setup. Filters 0-1 use mask 0.
+  void set_filter_mask(uint8_t num, uint32_t mask, bool extended) {
+    this->filter_masks_[num] = {mask, extended};
+    this->use_filters_ = true;
+  }
+  void set_filter(uint8_t num, uint32_t can_id, bool extended) { this->filters_[num] = {can_id, extended}; }
   static const struct TxBnRegs {
     REGISTER CTRL;
     REGISTER SIDH;
@@ -75,6 +83,14 @@ class MCP2515 : public canbus::Canbus,
  protected:
   CanClock mcp_clock_{MCP_8MHZ};
   CanctrlReqopMode mcp_mode_ = CANCTRL_REQOP_NORMAL;
+  GPIOPin *interrupt_pin_{nullptr};
+  struct FilterId {
+    uint32_t id;
+    bool extended;
+  };
+  FilterId filter_masks_[2]{};
+  FilterId filters_[6]{};
+  bool use_filters_{false};
   bool setup_internal() override;
   canbus::Error set_mode_(CanctrlReqopMode mode);
 
@@ -91,10 +107,13 @@ class MCP2515 : public canbus::Canbus,
   canbus::Error set_bitrate_(canbus::CanSpeed can_speed, CanClock can_clock);
   canbus::Error set_filter_mask_(MASK mask, bool extended, uint32_t ul_data);
   canbus::Error set_filter_(RXF num, bool extended, uint32_t ul_data);
+  canbus::Error setup_filters_();
   canbus::Error send_message_(TXBn txbn, struct canbus::CanFrame *frame);
   canbus::Error send_message(struct canbus::CanFrame *frame) override;
   canbus::Error read_message_(RXBn rxbn, struct canbus::CanFrame *frame);
   canbus::Error read_message(struct canbus::CanFrame *frame) override;
+  uint32_t read_dropped_frames_() override;
+  bool frame_pending_() override;
   bool check_receive_();
   bool check_error_();
   uint8_t get_error_flags_();
@@ -7,6 +7,7 @@ namespace esphome {
 namespace nextion {
 
 static const char *const TAG = "nextion";
+static const uint32_t QUEUE_STATS_INTERVAL = 60000;
 
 void Nextion::setup() {
   this->is_setup_ = false;
@@ -23,6 +24,8 @@ void Nextion::setup() {
   this->send_command_("rest");
 
   this->ignore_is_setup_ = false;
+
+  this->set_interval("queue_stats", QUEUE_STATS_INTERVAL, [this]() { this->log_queue_stats_(); });
 }
 
 bool Nextion::send_command_(const std::string &command) {
@@ -110,7 +113,10 @@ void Nextion::reset_(bool reset_nextion) {
   while (this->available()) {  // Clear receive buffer
     this->read_byte(&d);
   };
-  this->nextion_queue_.clear();
+  this->pending_head_ = 0;
+  this->pending_count_ = 0;
+  this->send_queue_head_ = 0;
+  this->send_queue_count_ = 0;
 }
 
 void Nextion::dump_config() {
@@ -184,28 +190,17 @@ bool Nextion::send_command_printf(const char *format, ...) {
     return false;
   }
 
-  if (this->send_command_(buffer)) {
-    this->add_no_result_to_queue_("send_command_printf");
-    return true;
-  }
-  return false;
+  return this->queue_command_(nullptr, NextionQueueType::NO_RESULT, "send_command_printf", buffer);
 }
 
 #ifdef NEXTION_PROTOCOL_LOG
 void Nextion::print_queue_members_() {
-  ESP_LOGN(TAG, "print_queue_members_ (top 10) size %zu", this->nextion_queue_.size());
+  ESP_LOGN(TAG, "print_queue_members_ (top 10) size %u", this->pending_count_);
   ESP_LOGN(TAG, "*******************************************");
-  int count = 0;
-  for (auto *i : this->nextion_queue_) {
-    if (count++ == 10)
-      break;
-
-    if (i == nullptr) {
-      ESP_LOGN(TAG, "Nextion queue is null");
-    } else {
-      ESP_LOGN(TAG, "Nextion queue type: %d:%s , name: %s", i->component->get_queue_type(),
-               i->component->get_queue_type_string().c_str(), i->component->get_variable_name().c_str());
-    }
+  for (uint8_t i = 0; i < this->pending_count_ && i < 10; i++) {
+    NextionPendingCommand &entry = this->pending_at_(i);
+    ESP_LOGN(TAG, "Nextion queue type: %d:%s , name: %s", entry.queue_type,
+             NEXTION_QUEUE_TYPE_STRINGS[entry.queue_type], this->pending_name_(entry).c_str());
   }
   ESP_LOGN(TAG, "*******************************************");
 }
@@ -238,6 +233,7 @@ void Nextion::loop() {
 
   this->process_serial_();            // Receive serial data
   this->process_nextion_commands_();  // Process nextion return commands
+  this->send_queued_commands_();      // Send commands held back until responses arrived
 
   if (!this->nextion_reports_is_setup_) {
     if (this->started_ms_ == 0)
@@ -251,28 +247,155 @@ void Nextion::loop() {
 }
 
 bool Nextion::remove_from_q_(bool report_empty) {
-  if (this->nextion_queue_.empty()) {
+  if (this->pending_count_ == 0) {
     if (report_empty)
       ESP_LOGE(TAG, "Nextion queue is empty!");
     return false;
   }
 
-  NextionQueue *nb = this->nextion_queue_.front();
-  NextionComponentBase *component = nb->component;
+  NextionPendingCommand &entry = this->pending_at_(0);
+  ESP_LOGN(TAG, "Removing %s from the queue", this->pending_name_(entry).c_str());
 
-  ESP_LOGN(TAG, "Removing %s from the queue", component->get_variable_name().c_str());
+  if (entry.queue_type == NextionQueueType::NO_RESULT && entry.variable_name == "sleep_wake") {
+    this->is_sleeping_ = false;
+  }
+  this->remove_pending_command_(0, true);
+  return true;
+}
 
-  if (component->get_queue_type() == NextionQueueType::NO_RESULT) {
-    if (component->get_variable_name() == "sleep_wake") {
-      this->is_sleeping_ = false;
+bool Nextion::queue_command_(NextionComponentBase *component, NextionQueueType queue_type,
+                             const std::string &variable_name, const std::string &command) {
+  // Send right away unless earlier commands are still held back, they have to go out first
+  if (this->send_queue_count_ == 0 && this->pending_count_ < MAX_PENDING_COMMANDS) {
+    if (!this->send_command_(command))
+      return false;
+    this->add_pending_command_(component, queue_type, variable_name);
+    return true;
+  }
+
+  if (component != nullptr) {
+    // A poll of a component that is already waiting to be polled would only return the same value
+    for (uint8_t i = 0; i < this->send_queue_count_; i++) {
+      if (this->send_queue_[(this->send_queue_head_ + i) % MAX_QUEUED_COMMANDS].component == component)
+        return true;
     }
-    delete component;  // NOLINT(cppcoreguidelines-owning-memory)
   }
-  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
-  this->nextion_queue_.pop_front();
+
+  if (this->send_queue_count_ == MAX_QUEUED_COMMANDS) {
+    this->dropped_commands_++;
+    ESP_LOGW(TAG, "%u commands are waiting to be sent, dropping \"%s\"", MAX_QUEUED_COMMANDS, command.c_str());
+    return false;
+  }
+
+  NextionQueuedCommand &entry =
+      this->send_queue_[(this->send_queue_head_ + this->send_queue_count_) % MAX_QUEUED_COMMANDS];
+  entry.component = component;
+  entry.queue_type = queue_type;
+  // Slots are reused, so after a while assigning the strings doesn't allocate anymore
+  entry.variable_name.assign(variable_name);
+  entry.command.assign(command);
+  this->send_queue_count_++;
   return true;
 }
 
+void Nextion::send_queued_commands_() {
+  while (this->send_queue_count_ > 0 && this->pending_count_ < MAX_PENDING_COMMANDS) {
+    NextionQueuedCommand &entry = this->send_queue_[this->send_queue_head_];
+    if (!this->send_command_(entry.command))
+      return;
+    this->add_pending_command_(entry.component, entry.queue_type, entry.variable_name);
+    this->send_queue_head_ = (this->send_queue_head_ + 1) % MAX_QUEUED_COMMANDS;
+    this->send_queue_count_--;
+  }
+}
+
+void Nextion::add_pending_command_(NextionComponentBase *component, NextionQueueType queue_type,
+                                   const std::string &variable_name) {
+  NextionPendingCommand &entry = this->pending_at_(this->pending_count_);
+  entry.component = component;
+  entry.queue_type = queue_type;
+  // Slots are reused, so after a while assigning the name doesn't allocate anymore
+  entry.variable_name.assign(variable_name);
+  entry.queue_time = millis();
+  this->pending_count_++;
+  if (this->pending_count_ > this->pending_max_depth_)
+    this->pending_max_depth_ = this->pending_count_;
+}
+
+void Nextion::remove_pending_command_(uint8_t index, bool is_response) {
+  if (is_response) {
+    uint32_t response_time = millis() - this->pending_at_(index).queue_time;
+    this->responses_++;
+    this->response_time_total_ += response_time;
+    if (response_time > this->response_time_max_)
+      this->response_time_max_ = response_time;
+  }
+  if (index == 0) {
+    this->pending_head_ = (this->pending_head_ + 1) % MAX_PENDING_COMMANDS;
+  } else {
+    // Move the removed slot to the end, swapping keeps the name buffers without copying
+    for (uint8_t i = index; i + 1 < this->pending_count_; i++)
+      std::swap(this->pending_at_(i), this->pending_at_(i + 1));
+  }
+  this->pending_count_--;
+}
+
+int Nextion::find_pending_response_(bool numeric) {
+  // Responses arrive in order, but if the acknowledgement of a command without result got lost, the response belongs
+  // to a later entry. Skipping those keeps a single lost reply from shifting all later responses.
+  for (uint8_t i = 0; i < this->pending_count_; i++) {
+    NextionQueueType type = this->pending_at_(i).queue_type;
+    bool matches = numeric ? (type == NextionQueueType::SENSOR || type == NextionQueueType::BINARY_SENSOR ||
+                              type == NextionQueueType::SWITCH)
+                           : type == NextionQueueType::TEXT_SENSOR;
+    if (matches)
+      return i;
+    if (type != NextionQueueType::NO_RESULT)
+      break;
+  }
+  return -1;
+}
+
+void Nextion::drop_lost_responses_(int index) {
+  for (int i = 0; i < index; i++) {
+    std::string name = this->pending_name_(this->pending_at_(0));
+    ESP_LOGD(TAG, "No response received for \"%s\"", name.c_str());
+    if (name == "sleep_wake") {
+      this->is_sleeping_ = false;
+    }
+    this->timed_out_commands_++;
+    this->remove_pending_command_(0, false);
+  }
+}
+
+void Nextion::sweep_pending_commands_(uint32_t now) {
+  // Entries are ordered by the time they were sent, so the expired ones are all at the front
+  while (this->pending_count_ > 0) {
+    NextionPendingCommand &entry = this->pending_at_(0);
+    if (entry.queue_time + this->max_q_age_ms_ >= now)
+      break;
+
+    std::string name = this->pending_name_(entry);
+    if (entry.queue_time == 0) {
+      ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\" queue_time 0",
+               NEXTION_QUEUE_TYPE_STRINGS[entry.queue_type], name.c_str());
+    }
+    if (name == "sleep_wake") {
+      this->is_sleeping_ = false;
+    }
+    ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\"", NEXTION_QUEUE_TYPE_STRINGS[entry.queue_type],
+             name.c_str());
+    this->timed_out_commands_++;
+    this->remove_pending_command_(0, false);
+  }
+}
+
+void Nextion::log_queue_stats_() {
+  ESP_LOGD(TAG, "Queue: %u pending (max %u), %u held back, response time avg %u ms max %u ms, %u timed out, %u dropped",
+           this->pending_count_, this->pending_max_depth_, this->send_queue_count_, this->get_average_response_time(),
+           this->response_time_max_, this->timed_out_commands_, this->dropped_commands_);
+}
+
 void Nextion::process_serial_() {
   uint8_t d;
 
@@ -295,7 +418,7 @@ void Nextion::process_nextion_commands_() {
   this->print_queue_members_();
 #endif
   while ((to_process_length = this->command_data_.find(COMMAND_DELIMITER)) != std::string::npos) {
-    ESP_LOGN(TAG, "print_queue_members_ size %zu", this->nextion_queue_.size());
+    ESP_LOGN(TAG, "print_queue_members_ size %u", this->pending_count_);
     while (to_process_length + COMMAND_DELIMITER.length() < this->command_data_.length() &&
            static_cast<uint8_t>(this->command_data_[to_process_length + COMMAND_DELIMITER.length()]) == 0xFF) {
       ++to_process_length;
@@ -316,11 +439,11 @@ void Nextion::process_nextion_commands_() {
       case 0x01:  // instruction sent by user was successful
 
         ESP_LOGVV(TAG, "instruction sent by user was successful");
-        ESP_LOGN(TAG, "this->nextion_queue_.empty() %s", this->nextion_queue_.empty() ? "True" : "False");
+        ESP_LOGN(TAG, "this->pending_count_ %u", this->pending_count_);
 
         this->remove_from_q_();
         if (!this->is_setup_) {
-          if (this->nextion_queue_.empty()) {
+          if (this->pending_count_ == 0) {
             ESP_LOGD(TAG, "Nextion is setup");
             this->is_setup_ = true;
             this->setup_callback_.call();
@@ -355,31 +478,25 @@ void Nextion::process_nextion_commands_() {
         break;
       case 0x12:  // invalid Waveform ID or Channel # was used
 
-        if (!this->nextion_queue_.empty()) {
-          int index = 0;
+        if (this->pending_count_ > 0) {
           int found = -1;
-          for (auto &nb : this->nextion_queue_) {
-            NextionComponentBase *component = nb->component;
-
-            if (component->get_queue_type() == NextionQueueType::WAVEFORM_SENSOR) {
+          for (uint8_t i = 0; i < this->pending_count_; i++) {
+            NextionPendingCommand &entry = this->pending_at_(i);
+            if (entry.queue_type == NextionQueueType::WAVEFORM_SENSOR) {
+              NextionComponentBase *component = entry.component;
               ESP_LOGW(TAG, "Nextion reported invalid Waveform ID %d or Channel # %d was used!",
                        component->get_component_id(), component->get_wave_channel_id());
 
               ESP_LOGN(TAG, "Removing waveform from queue with component id %d and waveform id %d",
                        component->get_component_id(), component->get_wave_channel_id());
 
-              found = index;
-
-              delete component;  // NOLINT(cppcoreguidelines-owning-memory)
-              delete nb;         // NOLINT(cppcoreguidelines-owning-memory)
-
+              found = i;
               break;
             }
-            ++index;
           }
 
           if (found != -1) {
-            this->nextion_queue_.erase(this->nextion_queue_.begin() + found);
+            this->remove_pending_command_(found, true);
           } else {
             ESP_LOGW(
                 TAG,
@@ -465,25 +582,25 @@ void Nextion::process_nextion_commands_() {
       //  data: ab123
       case 0x70:  // string variable data return
       {
-        if (this->nextion_queue_.empty()) {
+        if (this->pending_count_ == 0) {
           ESP_LOGW(TAG, "ERROR: Received string return but the queue is empty");
           break;
         }
 
-        NextionQueue *nb = this->nextion_queue_.front();
-        NextionComponentBase *component = nb->component;
-
-        if (component->get_queue_type() != NextionQueueType::TEXT_SENSOR) {
+        int index = this->find_pending_response_(false);
+        if (index == -1) {
           ESP_LOGE(TAG, "ERROR: Received string return but next in queue \"%s\" is not a text sensor",
-                   component->get_variable_name().c_str());
+                   this->pending_name_(this->pending_at_(0)).c_str());
+          index = 0;
         } else {
+          NextionComponentBase *component = this->pending_at_(index).component;
           ESP_LOGN(TAG, "Received get_string response: \"%s\" for component id: %s, type: %s", to_process.c_str(),
                    component->get_variable_name().c_str(), component->get_queue_type_string().c_str());
           component->set_state_from_string(to_process, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
-        this->nextion_queue_.pop_front();
+        this->drop_lost_responses_(index);
+        this->remove_pending_command_(0, true);
 
         break;
       }
@@ -494,7 +611,7 @@ void Nextion::process_nextion_commands_() {
         //  data: 67305985
       case 0x71:  // numeric variable data return
       {
-        if (this->nextion_queue_.empty()) {
+        if (this->pending_count_ == 0) {
           ESP_LOGE(TAG, "ERROR: Received numeric return but the queue is empty");
           break;
         }
@@ -513,23 +630,22 @@ void Nextion::process_nextion_commands_() {
           ++dataindex;
         }
 
-        NextionQueue *nb = this->nextion_queue_.front();
-        NextionComponentBase *component = nb->component;
-
-        if (component->get_queue_type() != NextionQueueType::SENSOR &&
-            component->get_queue_type() != NextionQueueType::BINARY_SENSOR &&
-            component->get_queue_type() != NextionQueueType::SWITCH) {
+        int index = this->find_pending_response_(true);
+        if (index == -1) {
+          NextionPendingCommand &front = this->pending_at_(0);
           ESP_LOGE(TAG, "ERROR: Received numeric return but next in queue \"%s\" is not a valid sensor type %d",
-                   component->get_variable_name().c_str(), component->get_queue_type());
+                   this->pending_name_(front).c_str(), front.queue_type);
+          index = 0;
         } else {
+          NextionComponentBase *component = this->pending_at_(index).component;
           ESP_LOGN(TAG, "Received numeric return for variable %s, queue type %d:%s, value %d",
                    component->get_variable_name().c_str(), component->get_queue_type(),
                    component->get_queue_type_string().c_str(), value);
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
-        this->nextion_queue_.pop_front();
+        this->drop_lost_responses_(index);
+        this->remove_pending_command_(0, true);
 
         break;
       }
@@ -685,11 +801,11 @@ void Nextion::process_nextion_commands_() {
       case 0xFE: {  // data transparent transmit ready
         ESP_LOGVV(TAG, "Nextion reported ready for transmit!");
 
-        int index = 0;
         int found = -1;
-        for (auto &nb : this->nextion_queue_) {
-          auto *component = nb->component;
-          if (component->get_queue_type() == NextionQueueType::WAVEFORM_SENSOR) {
+        for (uint8_t i = 0; i < this->pending_count_; i++) {
+          NextionPendingCommand &entry = this->pending_at_(i);
+          if (entry.queue_type == NextionQueueType::WAVEFORM_SENSOR) {
+            auto *component = entry.component;
             size_t buffer_to_send = component->get_wave_buffer().size() < 255 ? component->get_wave_buffer().size()
                                                                               : 255;  // ADDT command can only send 255
 
@@ -704,19 +820,16 @@ void Nextion::process_nextion_commands_() {
               component->get_wave_buffer().erase(component->get_wave_buffer().begin(),
                                                  component->get_wave_buffer().begin() + buffer_to_send);
             }
-            found = index;
-            delete component;  // NOLINT(cppcoreguidelines-owning-memory)
-            delete nb;         // NOLINT(cppcoreguidelines-owning-memory)
+            found = i;
             break;
           }
-          ++index;
         }
 
         if (found == -1) {
           ESP_LOGE(TAG, "No waveforms in queue to send data!");
           break;
         } else {
-          this->nextion_queue_.erase(this->nextion_queue_.begin() + found);
+          this->remove_pending_command_(found, true);
         }
         break;
       }
@@ -733,39 +846,7 @@ void Nextion::process_nextion_commands_() {
 
   uint32_t ms = millis();
 
-  if (!this->nextion_queue_.empty() && this->nextion_queue_.front()->queue_time + this->max_q_age_ms_ < ms) {
-    for (size_t i = 0; i < this->nextion_queue_.size(); i++) {
-      NextionComponentBase *component = this->nextion_queue_[i]->component;
-      if (this->nextion_queue_[i]->queue_time + this->max_q_age_ms_ < ms) {
-        if (this->nextion_queue_[i]->queue_time == 0) {
-          ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\" queue_time 0",
-                   component->get_queue_type_string().c_str(), component->get_variable_name().c_str());
-        }
-
-        if (component->get_variable_name() == "sleep_wake") {
-          this->is_sleeping_ = false;
-        }
-
-        ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\"", component->get_queue_type_string().c_str(),
-                 component->get_variable_name().c_str());
-
-        if (component->get_queue_type() == NextionQueueType::NO_RESULT) {
-          if (component->get_variable_name() == "sleep_wake") {
-            this->is_sleeping_ = false;
-          }
-          delete component;  // NOLINT(cppcoreguidelines-owning-memory)
-        }
-
-        delete this->nextion_queue_[i];  // NOLINT(cppcoreguidelines-owning-memory)
-
-        this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
-        i--;
-
-      } else {
-        break;
-      }
-    }
-  }
+  this->sweep_pending_commands_(ms);
   ESP_LOGN(TAG, "Loop End");
   // App.feed_wdt(); Remove before master merge
   this->process_serial_();
@@ -905,26 +986,6 @@ uint16_t Nextion::recv_ret_string_(std::string &response, uint32_t timeout, bool
   return ret;
 }
 
-/**
- * @brief
- *
- * @param variable_name Name for the queue
- */
-void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion_queue->component = new nextion::NextionComponentBase;
-  nextion_queue->component->set_variable_name(variable_name);
-
-  nextion_queue->queue_time = millis();
-
-  this->nextion_queue_.push_back(nextion_queue);
-
-  ESP_LOGN(TAG, "Add to queue type: NORESULT component %s", nextion_queue->component->get_variable_name().c_str());
-}
-
 /**
  * @brief
  *
@@ -935,9 +996,8 @@ void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_n
   if ((!this->is_setup() && !this->ignore_is_setup_) || command.empty())
     return;
 
-  if (this->send_command_(command)) {
-    this->add_no_result_to_queue_(variable_name);
-  }
+  ESP_LOGN(TAG, "Add to queue type: NORESULT component %s", variable_name.c_str());
+  this->queue_command_(nullptr, NextionQueueType::NO_RESULT, variable_name, command);
 }
 
 bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format,
@@ -1045,20 +1105,11 @@ void Nextion::add_to_get_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
     return;
 
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  nextion_queue->component = component;
-  nextion_queue->queue_time = millis();
-
   ESP_LOGN(TAG, "Add to queue type: %s component %s", component->get_queue_type_string().c_str(),
            component->get_variable_name().c_str());
 
   std::string command = "get " + component->get_variable_name_to_send();
-
-  if (this->send_command_(command)) {
-    this->nextion_queue_.push_back(nextion_queue);
-  }
+  this->queue_command_(component, component->get_queue_type(), "", command);
 }
 
 /**
@@ -1073,21 +1124,13 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return;
 
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion_queue->component = new nextion::NextionComponentBase;
-  nextion_queue->queue_time = millis();
-
   size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
                                                                   : 255;  // ADDT command can only send 255
 
   std::string command = "addt " + to_string(component->get_component_id()) + "," +
                         to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
-  if (this->send_command_(command)) {
-    this->nextion_queue_.push_back(nextion_queue);
-  }
+  // Tracked like a command without result (with an empty name)
+  this->queue_command_(nullptr, NextionQueueType::NO_RESULT, "", command);
 }
 
 void Nextion::set_writer(const nextion_writer_t &writer) { this->writer_ = writer; }
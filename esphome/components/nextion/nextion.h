@@ -1,6 +1,6 @@
 #pragma once
 
-#include <deque>
+#include <array>
 #include "esphome/core/defines.h"
 #include "esphome/components/uart/uart.h"
 #include "nextion_base.h"
@@ -727,8 +727,69 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   void set_wake_up_page_internal(uint8_t wake_up_page) { this->wake_up_page_ = wake_up_page; }
   void set_auto_wake_on_touch_internal(bool auto_wake_on_touch) { this->auto_wake_on_touch_ = auto_wake_on_touch; }
 
+  /// Number of commands currently waiting for a response.
+  uint8_t get_pending_commands() const { return this->pending_count_; }
+  /// Number of commands held back until a response frees a pending slot.
+  uint8_t get_queued_commands() const { return this->send_queue_count_; }
+  /// Highest number of commands that were waiting for a response at the same time.
+  uint8_t get_max_pending_commands() const { return this->pending_max_depth_; }
+  /// Average time between sending a command and receiving its response in ms.
+  uint32_t get_average_response_time() const {
+    return this->responses_ == 0 ? 0 : this->response_time_total_ / this->responses_;
+  }
+  /// Longest time between sending a command and receiving its response in ms.
+  uint32_t get_max_response_time() const { return this->response_time_max_; }
+  /// Number of commands that got no response before max_q_age_ms_ or whose response was lost.
+  uint32_t get_timed_out_commands() const { return this->timed_out_commands_; }
+  /// Number of commands not sent because the queue of held back commands was full.
+  uint32_t get_dropped_commands() const { return this->dropped_commands_; }
+
  protected:
-  std::deque<NextionQueue *> nextion_queue_;
+  /// Maximum number of commands waiting for a response, more commands are held back until responses arrive.
+  static const uint8_t MAX_PENDING_COMMANDS = 32;
+  /// Maximum number of commands held back, further commands are dropped.
+  static const uint8_t MAX_QUEUED_COMMANDS = 64;
+  /// Ring buffer of commands waiting for a response, in the order they were sent.
+  std::array<NextionPendingCommand, MAX_PENDING_COMMANDS> pending_commands_{};
+  uint8_t pending_head_ = 0;
+  uint8_t pending_count_ = 0;
+  uint8_t pending_max_depth_ = 0;
+  uint32_t responses_ = 0;
+  uint32_t response_time_total_ = 0;
+  uint32_t response_time_max_ = 0;
+  uint32_t timed_out_commands_ = 0;
+  uint32_t dropped_commands_ = 0;
+  /// Ring buffer of commands not sent yet, in the order they were issued.
+  std::array<NextionQueuedCommand, MAX_QUEUED_COMMANDS> send_queue_{};
+  uint8_t send_queue_head_ = 0;
+  uint8_t send_queue_count_ = 0;
+
+  NextionPendingCommand &pending_at_(uint8_t index) {
+    return this->pending_commands_[(this->pending_head_ + index) % MAX_PENDING_COMMANDS];
+  }
+  std::string pending_name_(const NextionPendingCommand &entry) {
+    return entry.component != nullptr ? entry.component->get_variable_name() : entry.variable_name;
+  }
+  /** Send a command and track its response, or hold it back while MAX_PENDING_COMMANDS are waiting for a response.
+   *
+   * Returns false if the command was dropped because too many commands are held back already.
+   */
+  bool queue_command_(NextionComponentBase *component, NextionQueueType queue_type, const std::string &variable_name,
+                      const std::string &command);
+  /// Send held back commands while there are free pending slots.
+  void send_queued_commands_();
+  void add_pending_command_(NextionComponentBase *component, NextionQueueType queue_type,
+                            const std::string &variable_name);
+  /// Remove the entry at index, a response for it was received when is_response is set.
+  void remove_pending_command_(uint8_t index, bool is_response);
+  /// Index of the entry a string (TEXT_SENSOR) or numeric response belongs to, -1 if there's none.
+  int find_pending_response_(bool numeric);
+  /// Drop the entries in front of index, their responses got lost.
+  void drop_lost_responses_(int index);
+  /// Drop all entries whose response didn't arrive within max_q_age_ms_.
+  void sweep_pending_commands_(uint32_t now);
+  void log_queue_stats_();
+
   uint16_t recv_ret_string_(std::string &response, uint32_t timeout, bool recv_flag);
   void all_components_send_state_(bool force_update = false);
   uint64_t comok_sent_ = 0;
@@ -753,7 +814,6 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    * @param command The command to write, for example "vis b0,0".
    */
   bool send_command_(const std::string &command);
-  void add_no_result_to_queue_(const std::string &variable_name);
   bool add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
   void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command);
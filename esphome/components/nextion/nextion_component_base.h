@@ -1,4 +1,5 @@
 #pragma once
+#include <string>
 #include <utility>
 #include "esphome/core/defines.h"
 
@@ -19,11 +20,23 @@ static const char *const NEXTION_QUEUE_TYPE_STRINGS[] = {"NO_RESULT", "SENSOR",
 
 class NextionComponentBase;
 
-class NextionQueue {
- public:
-  virtual ~NextionQueue() = default;
-  NextionComponentBase *component;
-  uint32_t queue_time = 0;
+/// A command sent to the Nextion that is waiting for its response. Entries are reused from a fixed pool.
+struct NextionPendingCommand {
+  /// Component receiving the response, nullptr for commands without result.
+  NextionComponentBase *component{nullptr};
+  /// Name of a command without result, used for logging and to track "sleep_wake".
+  std::string variable_name;
+  NextionQueueType queue_type{NextionQueueType::NO_RESULT};
+  uint32_t queue_time{0};
+};
+
+/// A command held back until a response frees a pending slot. Entries are reused from a fixed pool.
+struct NextionQueuedCommand {
+  /// Component receiving the response, nullptr for commands without result.
+  NextionComponentBase *component{nullptr};
+  std::string variable_name;
+  std::string command;
+  NextionQueueType queue_type{NextionQueueType::NO_RESULT};
 };
 
 class NextionComponentBase {
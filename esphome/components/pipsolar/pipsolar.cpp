@@ -47,84 +47,40 @@ void Pipsolar::loop() {
         } else {
           ESP_LOGD(TAG, "command not successful");
         }
-        this->command_queue_[this->command_queue_position_] = std::string("");
-        this->command_queue_position_ = (command_queue_position_ + 1) % COMMAND_QUEUE_LENGTH;
-        this->state_ = STATE_IDLE;
-
-      } else {
-        // crc failed
-        this->command_queue_[this->command_queue_position_] = std::string("");
-        this->command_queue_position_ = (command_queue_position_ + 1) % COMMAND_QUEUE_LENGTH;
-        this->state_ = STATE_IDLE;
       }
     } else {
       ESP_LOGD(TAG, "response length for command %s not OK: with length %zu",
-               this->command_queue_[this->command_queue_position_].c_str(), this->read_pos_);
-      this->command_queue_[this->command_queue_position_] = std::string("");
-      this->command_queue_position_ = (command_queue_position_ + 1) % COMMAND_QUEUE_LENGTH;
-      this->state_ = STATE_IDLE;
+               this->command_queue_[this->command_queue_position_], this->read_pos_);
     }
+    this->pop_command_();
+    this->state_ = STATE_IDLE;
   }
 
   if (this->state_ == STATE_POLL_DECODED) {
     std::string mode;
     switch (this->used_polling_commands_[this->last_polling_command_].identifier) {
       case POLLING_QPIRI:
-        if (this->grid_rating_voltage_) {
-          this->grid_rating_voltage_->publish_state(value_grid_rating_voltage_);
-        }
-        if (this->grid_rating_current_) {
-          this->grid_rating_current_->publish_state(value_grid_rating_current_);
-        }
-        if (this->ac_output_rating_voltage_) {
-          this->ac_output_rating_voltage_->publish_state(value_ac_output_rating_voltage_);
-        }
-        if (this->ac_output_rating_frequency_) {
-          this->ac_output_rating_frequency_->publish_state(value_ac_output_rating_frequency_);
-        }
-        if (this->ac_output_rating_current_) {
-          this->ac_output_rating_current_->publish_state(value_ac_output_rating_current_);
-        }
-        if (this->ac_output_rating_apparent_power_) {
-          this->ac_output_rating_apparent_power_->publish_state(value_ac_output_rating_apparent_power_);
-        }
-        if (this->ac_output_rating_active_power_) {
-          this->ac_output_rating_active_power_->publish_state(value_ac_output_rating_active_power_);
-        }
-        if (this->battery_rating_voltage_) {
-          this->battery_rating_voltage_->publish_state(value_battery_rating_voltage_);
-        }
-        if (this->battery_recharge_voltage_) {
-          this->battery_recharge_voltage_->publish_state(value_battery_recharge_voltage_);
-        }
-        if (this->battery_under_voltage_) {
-          this->battery_under_voltage_->publish_state(value_battery_under_voltage_);
-        }
-        if (this->battery_bulk_voltage_) {
-          this->battery_bulk_voltage_->publish_state(value_battery_bulk_voltage_);
-        }
-        if (this->battery_float_voltage_) {
-          this->battery_float_voltage_->publish_state(value_battery_float_voltage_);
-        }
-        if (this->battery_type_) {
-          this->battery_type_->publish_state(value_battery_type_);
-        }
-        if (this->current_max_ac_charging_current_) {
-          this->current_max_ac_charging_current_->publish_state(value_current_max_ac_charging_current_);
-        }
-        if (this->current_max_charging_current_) {
-          this->current_max_charging_current_->publish_state(value_current_max_charging_current_);
-        }
-        if (this->input_voltage_range_) {
-          this->input_voltage_range_->publish_state(value_input_voltage_range_);
-        }
+        this->publish_sensor_(this->grid_rating_voltage_, this->value_grid_rating_voltage_);
+        this->publish_sensor_(this->grid_rating_current_, this->value_grid_rating_current_);
+        this->publish_sensor_(this->ac_output_rating_voltage_, this->value_ac_output_rating_voltage_);
+        this->publish_sensor_(this->ac_output_rating_frequency_, this->value_ac_output_rating_frequency_);
+        this->publish_sensor_(this->ac_output_rating_current_, this->value_ac_output_rating_current_);
+        this->publish_sensor_(this->ac_output_rating_apparent_power_, this->value_ac_output_rating_apparent_power_);
+        this->publish_sensor_(this->ac_output_rating_active_power_, this->value_ac_output_rating_active_power_);
+        this->publish_sensor_(this->battery_rating_voltage_, this->value_battery_rating_voltage_);
+        this->publish_sensor_(this->battery_recharge_voltage_, this->value_battery_recharge_voltage_);
+        this->publish_sensor_(this->battery_under_voltage_, this->value_battery_under_voltage_);
+        this->publish_sensor_(this->battery_bulk_voltage_, this->value_battery_bulk_voltage_);
+        this->publish_sensor_(this->battery_float_voltage_, this->value_battery_float_voltage_);
+        this->publish_sensor_(this->battery_type_, this->value_battery_type_);
+        this->publish_sensor_(this->current_max_ac_charging_current_, this->value_current_max_ac_charging_current_);
+        this->publish_sensor_(this->current_max_charging_current_, this->value_current_max_charging_current_);
+        this->publish_sensor_(this->input_voltage_range_, this->value_input_voltage_range_);
         // special for input voltage range switch
         if (this->input_voltage_range_switch_) {
           this->input_voltage_range_switch_->publish_state(value_input_voltage_range_ == 1);
         }
-        if (this->output_source_priority_) {
-          this->output_source_priority_->publish_state(value_output_source_priority_);
-        }
+        this->publish_sensor_(this->output_source_priority_, this->value_output_source_priority_);
         // special for output source priority switches
         if (this->output_source_priority_utility_switch_) {
           this->output_source_priority_utility_switch_->publish_state(value_output_source_priority_ == 0);
@@ -135,34 +91,18 @@ void Pipsolar::loop() {
         if (this->output_source_priority_battery_switch_) {
           this->output_source_priority_battery_switch_->publish_state(value_output_source_priority_ == 2);
         }
-        if (this->charger_source_priority_) {
-          this->charger_source_priority_->publish_state(value_charger_source_priority_);
-        }
-        if (this->parallel_max_num_) {
-          this->parallel_max_num_->publish_state(value_parallel_max_num_);
-        }
-        if (this->machine_type_) {
-          this->machine_type_->publish_state(value_machine_type_);
-        }
-        if (this->topology_) {
-          this->topology_->publish_state(value_topology_);
-        }
-        if (this->output_mode_) {
-          this->output_mode_->publish_state(value_output_mode_);
-        }
-        if (this->battery_redischarge_voltage_) {
-          this->battery_redischarge_voltage_->publish_state(value_battery_redischarge_voltage_);
-        }
-        if (this->pv_ok_condition_for_parallel_) {
-          this->pv_ok_condition_for_parallel_->publish_state(value_pv_ok_condition_for_parallel_);
-        }
+        this->publish_sensor_(this->charger_source_priority_, this->value_charger_source_priority_);
+        this->publish_sensor_(this->parallel_max_num_, this->value_parallel_max_num_);
+        this->publish_sensor_(this->machine_type_, this->value_machine_type_);
+        this->publish_sensor_(this->topology_, this->value_topology_);
+        this->publish_sensor_(this->output_mode_, this->value_output_mode_);
+        this->publish_sensor_(this->battery_redischarge_voltage_, this->value_battery_redischarge_voltage_);
+        this->publish_sensor_(this->pv_ok_condition_for_parallel_, this->value_pv_ok_condition_for_parallel_);
         // special for pv ok condition switch
         if (this->pv_ok_condition_for_parallel_switch_) {
           this->pv_ok_condition_for_parallel_switch_->publish_state(value_pv_ok_condition_for_parallel_ == 1);
         }
-        if (this->pv_power_balance_) {
-          this->pv_power_balance_->publish_state(value_pv_power_balance_ == 1);
-        }
+        this->publish_sensor_(this->pv_power_balance_, this->value_pv_power_balance_ == 1);
         // special for power balance switch
         if (this->pv_power_balance_switch_) {
           this->pv_power_balance_switch_->publish_state(value_pv_power_balance_ == 1);
@@ -170,54 +110,22 @@ void Pipsolar::loop() {
         this->state_ = STATE_IDLE;
         break;
       case POLLING_QPIGS:
-        if (this->grid_voltage_) {
-          this->grid_voltage_->publish_state(value_grid_voltage_);
-        }
-        if (this->grid_frequency_) {
-          this->grid_frequency_->publish_state(value_grid_frequency_);
-        }
-        if (this->ac_output_voltage_) {
-          this->ac_output_voltage_->publish_state(value_ac_output_voltage_);
-        }
-        if (this->ac_output_frequency_) {
-          this->ac_output_frequency_->publish_state(value_ac_output_frequency_);
-        }
-        if (this->ac_output_apparent_power_) {
-          this->ac_output_apparent_power_->publish_state(value_ac_output_apparent_power_);
-        }
-        if (this->ac_output_active_power_) {
-          this->ac_output_active_power_->publish_state(value_ac_output_active_power_);
-        }
-        if (this->output_load_percent_) {
-          this->output_load_percent_->publish_state(value_output_load_percent_);
-        }
-        if (this->bus_voltage_) {
-          this->bus_voltage_->publish_state(value_bus_voltage_);
-        }
-        if (this->battery_voltage_) {
-          this->battery_voltage_->publish_state(value_battery_voltage_);
-        }
-        if (this->battery_charging_current_) {
-          this->battery_charging_current_->publish_state(value_battery_charging_current_);
-        }
-        if (this->battery_capacity_percent_) {
-          this->battery_capacity_percent_->publish_state(value_battery_capacity_percent_);
-        }
-        if (this->inverter_heat_sink_temperature_) {
-          this->inverter_heat_sink_temperature_->publish_state(value_inverter_heat_sink_temperature_);
-        }
-        if (this->pv_input_current_for_battery_) {
-          this->pv_input_current_for_battery_->publish_state(value_pv_input_current_for_battery_);
-        }
-        if (this->pv_input_voltage_) {
-          this->pv_input_voltage_->publish_state(value_pv_input_voltage_);
-        }
-        if (this->battery_voltage_scc_) {
-          this->battery_voltage_scc_->publish_state(value_battery_voltage_scc_);
-        }
-        if (this->battery_discharge_current_) {
-          this->battery_discharge_current_->publish_state(value_battery_discharge_current_);
-        }
+        this->publish_sensor_(this->grid_voltage_, this->value_grid_voltage_);
+        this->publish_sensor_(this->grid_frequency_, this->value_grid_frequency_);
+        this->publish_sensor_(this->ac_output_voltage_, this->value_ac_output_voltage_);
+        this->publish_sensor_(this->ac_output_frequency_, this->value_ac_output_frequency_);
+        this->publish_sensor_(this->ac_output_apparent_power_, this->value_ac_output_apparent_power_);
+        this->publish_sensor_(this->ac_output_active_power_, this->value_ac_output_active_power_);
+        this->publish_sensor_(this->output_load_percent_, this->value_output_load_percent_);
+        this->publish_sensor_(this->bus_voltage_, this->value_bus_voltage_);
+        this->publish_sensor_(this->battery_voltage_, this->value_battery_voltage_);
+        this->publish_sensor_(this->battery_charging_current_, this->value_battery_charging_current_);
+        this->publish_sensor_(this->battery_capacity_percent_, this->value_battery_capacity_percent_);
+        this->publish_sensor_(this->inverter_heat_sink_temperature_, this->value_inverter_heat_sink_temperature_);
+        this->publish_sensor_(this->pv_input_current_for_battery_, this->value_pv_input_current_for_battery_);
+        this->publish_sensor_(this->pv_input_voltage_, this->value_pv_input_voltage_);
+        this->publish_sensor_(this->battery_voltage_scc_, this->value_battery_voltage_scc_);
+        this->publish_sensor_(this->battery_discharge_current_, this->value_battery_discharge_current_);
         if (this->add_sbu_priority_version_) {
           this->add_sbu_priority_version_->publish_state(value_add_sbu_priority_version_);
         }
@@ -243,15 +151,11 @@ void Pipsolar::loop() {
         if (this->ac_charging_status_) {
           this->ac_charging_status_->publish_state(value_ac_charging_status_);
         }
-        if (this->battery_voltage_offset_for_fans_on_) {
-          this->battery_voltage_offset_for_fans_on_->publish_state(value_battery_voltage_offset_for_fans_on_ / 10.0f);
-        }  //.1 scale
-        if (this->eeprom_version_) {
-          this->eeprom_version_->publish_state(value_eeprom_version_);
-        }
-        if (this->pv_charging_power_) {
-          this->pv_charging_power_->publish_state(value_pv_charging_power_);
-        }
+        // .1 scale
+        this->publish_sensor_(this->battery_voltage_offset_for_fans_on_,
+                              this->value_battery_voltage_offset_for_fans_on_ / 10.0f);
+        this->publish_sensor_(this->eeprom_version_, this->value_eeprom_version_);
+        this->publish_sensor_(this->pv_charging_power_, this->value_pv_charging_power_);
         if (this->charging_to_floating_mode_) {
           this->charging_to_floating_mode_->publish_state(value_charging_to_floating_mode_);
         }
@@ -422,23 +326,37 @@ void Pipsolar::loop() {
   if (this->state_ == STATE_POLL_CHECKED) {
     bool enabled = true;
     std::string fc;
-    char tmp[PIPSOLAR_READ_BUFFER_LENGTH];
-    sprintf(tmp, "%s", this->read_buffer_);
+    const char *tmp = (const char *) this->read_buffer_;  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+    const size_t length = this->read_pos_ - 3;
+    const uint32_t parse_start = micros();
     switch (this->used_polling_commands_[this->last_polling_command_].identifier) {
       case POLLING_QPIRI:
         ESP_LOGD(TAG, "Decode QPIRI");
-        sscanf(tmp, "(%f %f %f %f %f %d %d %f %f %f %f %f %d %d %d %d %d %d %d %d %d %d %f %d %d",          // NOLINT
-               &value_grid_rating_voltage_, &value_grid_rating_current_, &value_ac_output_rating_voltage_,  // NOLINT
-               &value_ac_output_rating_frequency_, &value_ac_output_rating_current_,                        // NOLINT
-               &value_ac_output_rating_apparent_power_, &value_ac_output_rating_active_power_,              // NOLINT
-               &value_battery_rating_voltage_, &value_battery_recharge_voltage_,                            // NOLINT
-               &value_battery_under_voltage_, &value_battery_bulk_voltage_, &value_battery_float_voltage_,  // NOLINT
-               &value_battery_type_, &value_current_max_ac_charging_current_,                               // NOLINT
-               &value_current_max_charging_current_, &value_input_voltage_range_,                           // NOLINT
-               &value_output_source_priority_, &value_charger_source_priority_, &value_parallel_max_num_,   // NOLINT
-               &value_machine_type_, &value_topology_, &value_output_mode_,                                 // NOLINT
-               &value_battery_redischarge_voltage_, &value_pv_ok_condition_for_parallel_,                   // NOLINT
-               &value_pv_power_balance_);                                                                   // NOLINT
+        this->parse_field_(0, this->value_grid_rating_voltage_);
+        this->parse_field_(1, this->value_grid_rating_current_);
+        this->parse_field_(2, this->value_ac_output_rating_voltage_);
+        this->parse_field_(3, this->value_ac_output_rating_frequency_);
+        this->parse_field_(4, this->value_ac_output_rating_current_);
+        this->parse_field_(5, this->value_ac_output_rating_apparent_power_);
+        this->parse_field_(6, this->value_ac_output_rating_active_power_);
+        this->parse_field_(7, this->value_battery_rating_voltage_);
+        this->parse_field_(8, this->value_battery_recharge_voltage_);
+        this->parse_field_(9, this->value_battery_under_voltage_);
+        this->parse_field_(10, this->value_battery_bulk_voltage_);
+        this->parse_field_(11, this->value_battery_float_voltage_);
+        this->parse_field_(12, this->value_battery_type_);
+        this->parse_field_(13, this->value_current_max_ac_charging_current_);
+        this->parse_field_(14, this->value_current_max_charging_current_);
+        this->parse_field_(15, this->value_input_voltage_range_);
+        this->parse_field_(16, this->value_output_source_priority_);
+        this->parse_field_(17, this->value_charger_source_priority_);
+        this->parse_field_(18, this->value_parallel_max_num_);
+        this->parse_field_(19, this->value_machine_type_);
+        this->parse_field_(20, this->value_topology_);
+        this->parse_field_(21, this->value_output_mode_);
+        this->parse_field_(22, this->value_battery_redischarge_voltage_);
+        this->parse_field_(23, this->value_pv_ok_condition_for_parallel_);
+        this->parse_field_(24, this->value_pv_power_balance_);
         if (this->last_qpiri_) {
           this->last_qpiri_->publish_state(tmp);
         }
@@ -446,22 +364,37 @@ void Pipsolar::loop() {
         break;
       case POLLING_QPIGS:
         ESP_LOGD(TAG, "Decode QPIGS");
-        sscanf(                                                                                              // NOLINT
-            tmp,                                                                                             // NOLINT
-            "(%f %f %f %f %d %d %d %d %f %d %d %d %d %f %f %d %1d%1d%1d%1d%1d%1d%1d%1d %d %d %d %1d%1d%1d",  // NOLINT
-            &value_grid_voltage_, &value_grid_frequency_, &value_ac_output_voltage_,                         // NOLINT
-            &value_ac_output_frequency_,                                                                     // NOLINT
-            &value_ac_output_apparent_power_, &value_ac_output_active_power_, &value_output_load_percent_,   // NOLINT
-            &value_bus_voltage_, &value_battery_voltage_, &value_battery_charging_current_,                  // NOLINT
-            &value_battery_capacity_percent_, &value_inverter_heat_sink_temperature_,                        // NOLINT
-            &value_pv_input_current_for_battery_, &value_pv_input_voltage_, &value_battery_voltage_scc_,     // NOLINT
-            &value_battery_discharge_current_, &value_add_sbu_priority_version_,                             // NOLINT
-            &value_configuration_status_, &value_scc_firmware_version_, &value_load_status_,                 // NOLINT
-            &value_battery_voltage_to_steady_while_charging_, &value_charging_status_,                       // NOLINT
-            &value_scc_charging_status_, &value_ac_charging_status_,                                         // NOLINT
-            &value_battery_voltage_offset_for_fans_on_, &value_eeprom_version_, &value_pv_charging_power_,   // NOLINT
-            &value_charging_to_floating_mode_, &value_switch_on_,                                            // NOLINT
-            &value_dustproof_installed_);                                                                    // NOLINT
+        this->parse_field_(0, this->value_grid_voltage_);
+        this->parse_field_(1, this->value_grid_frequency_);
+        this->parse_field_(2, this->value_ac_output_voltage_);
+        this->parse_field_(3, this->value_ac_output_frequency_);
+        this->parse_field_(4, this->value_ac_output_apparent_power_);
+        this->parse_field_(5, this->value_ac_output_active_power_);
+        this->parse_field_(6, this->value_output_load_percent_);
+        this->parse_field_(7, this->value_bus_voltage_);
+        this->parse_field_(8, this->value_battery_voltage_);
+        this->parse_field_(9, this->value_battery_charging_current_);
+        this->parse_field_(10, this->value_battery_capacity_percent_);
+        this->parse_field_(11, this->value_inverter_heat_sink_temperature_);
+        this->parse_field_(12, this->value_pv_input_current_for_battery_);
+        this->parse_field_(13, this->value_pv_input_voltage_);
+        this->parse_field_(14, this->value_battery_voltage_scc_);
+        this->parse_field_(15, this->value_battery_discharge_current_);
+        // device status bits, one digit each
+        this->parse_field_digit_(16, 0, this->value_add_sbu_priority_version_);
+        this->parse_field_digit_(16, 1, this->value_configuration_status_);
+        this->parse_field_digit_(16, 2, this->value_scc_firmware_version_);
+        this->parse_field_digit_(16, 3, this->value_load_status_);
+        this->parse_field_digit_(16, 4, this->value_battery_voltage_to_steady_while_charging_);
+        this->parse_field_digit_(16, 5, this->value_charging_status_);
+        this->parse_field_digit_(16, 6, this->value_scc_charging_status_);
+        this->parse_field_digit_(16, 7, this->value_ac_charging_status_);
+        this->parse_field_(17, this->value_battery_voltage_offset_for_fans_on_);
+        this->parse_field_(18, this->value_eeprom_version_);
+        this->parse_field_(19, this->value_pv_charging_power_);
+        this->parse_field_digit_(20, 0, this->value_charging_to_floating_mode_);
+        this->parse_field_digit_(20, 1, this->value_switch_on_);
+        this->parse_field_digit_(20, 2, this->value_dustproof_installed_);
         if (this->last_qpigs_) {
           this->last_qpigs_->publish_state(tmp);
         }
@@ -479,7 +412,7 @@ void Pipsolar::loop() {
         ESP_LOGD(TAG, "Decode QFLAG");
         // result like:"(EbkuvxzDajy"
         // get through all char: ignore first "(" Enable flag on 'E', Disable on 'D') else set the corresponding value
-        for (size_t i = 1; i < strlen(tmp); i++) {
+        for (size_t i = 1; i < length; i++) {
           switch (tmp[i]) {
             case 'E':
               enabled = true;
@@ -528,7 +461,7 @@ void Pipsolar::loop() {
         this->value_warnings_present_ = false;
         this->value_faults_present_ = true;
 
-        for (size_t i = 1; i < strlen(tmp); i++) {
+        for (size_t i = 1; i < length; i++) {
           enabled = tmp[i] == '1';
           switch (i) {
             case 1:
@@ -693,6 +626,12 @@ void Pipsolar::loop() {
         this->state_ = STATE_IDLE;
         break;
     }
+    this->parse_micros_ = micros() - parse_start;
+    if (this->state_ == STATE_POLL_DECODED) {
+      ESP_LOGD(TAG, "Poll %s: round trip %u ms, parsed %u fields in %u us",
+               this->used_polling_commands_[this->last_polling_command_].command, this->round_trip_millis_,
+               this->field_count_, this->parse_micros_);
+    }
     return;
   }
 
@@ -716,18 +655,27 @@ void Pipsolar::loop() {
       uint8_t byte;
       this->read_byte(&byte);
 
-      if (this->read_pos_ == PIPSOLAR_READ_BUFFER_LENGTH) {
-        this->read_pos_ = 0;
+      // keep room for the terminating zero
+      if (this->read_pos_ == PIPSOLAR_READ_BUFFER_LENGTH - 1) {
+        this->reset_read_buffer_();
         this->empty_uart_buffer_();
       }
       this->read_buffer_[this->read_pos_] = byte;
       this->read_pos_++;
 
+      // tokenize while receiving: "(" starts the first field, every space the next one
+      if ((this->read_pos_ == 1 && byte == '(') || (byte == ' ' && this->field_count_ != 0)) {
+        if (this->field_count_ < PIPSOLAR_MAX_FIELDS) {
+          this->field_starts_[this->field_count_++] = this->read_pos_;
+        }
+      }
+
       // end of answer
       if (byte == 0x0D) {
         this->read_buffer_[this->read_pos_] = 0;
         this->empty_uart_buffer_();
         if (this->state_ == STATE_POLL) {
+          this->round_trip_millis_ = millis() - this->command_start_millis_;
           this->state_ = STATE_POLL_COMPLETE;
         }
         if (this->state_ == STATE_COMMAND) {
@@ -739,11 +687,9 @@ void Pipsolar::loop() {
   if (this->state_ == STATE_COMMAND) {
     if (millis() - this->command_start_millis_ > esphome::pipsolar::Pipsolar::COMMAND_TIMEOUT) {
       // command timeout
-      const char *command = this->command_queue_[this->command_queue_position_].c_str();
       this->command_start_millis_ = millis();
-      ESP_LOGD(TAG, "timeout command from queue: %s", command);
-      this->command_queue_[this->command_queue_position_] = std::string("");
-      this->command_queue_position_ = (command_queue_position_ + 1) % COMMAND_QUEUE_LENGTH;
+      ESP_LOGD(TAG, "timeout command from queue: %s", this->command_queue_[this->command_queue_position_]);
+      this->pop_command_();
       this->state_ = STATE_IDLE;
       return;
     } else {
@@ -786,19 +732,15 @@ uint8_t Pipsolar::check_incoming_crc_() {
 // send next command used
 uint8_t Pipsolar::send_next_command_() {
   uint16_t crc16;
-  if (this->command_queue_[this->command_queue_position_].length() != 0) {
-    const char *command = this->command_queue_[this->command_queue_position_].c_str();
-    uint8_t byte_command[16];
-    uint8_t length = this->command_queue_[this->command_queue_position_].length();
-    for (uint8_t i = 0; i < length; i++) {
-      byte_command[i] = (uint8_t) this->command_queue_[this->command_queue_position_].at(i);
-    }
+  const char *command = this->command_queue_[this->command_queue_position_];
+  uint8_t length = strlen(command);
+  if (length != 0) {
     this->state_ = STATE_COMMAND;
     this->command_start_millis_ = millis();
     this->empty_uart_buffer_();
-    this->read_pos_ = 0;
-    crc16 = calc_crc_(byte_command, length);
-    this->write_str(command);
+    this->reset_read_buffer_();
+    crc16 = calc_crc_((uint8_t *) command, length);  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
+    this->write_array((const uint8_t *) command, length);  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast)
     // checksum
     this->write(((uint8_t)((crc16) >> 8)));   // highbyte
     this->write(((uint8_t)((crc16) &0xff)));  // lowbyte
@@ -810,6 +752,16 @@ uint8_t Pipsolar::send_next_command_() {
   return 0;
 }
 
+void Pipsolar::reset_read_buffer_() {
+  this->read_pos_ = 0;
+  this->field_count_ = 0;
+}
+
+void Pipsolar::pop_command_() {
+  this->command_queue_[this->command_queue_position_][0] = '\0';
+  this->command_queue_position_ = (this->command_queue_position_ + 1) % COMMAND_QUEUE_LENGTH;
+}
+
 void Pipsolar::send_next_poll_() {
   uint16_t crc16;
   this->last_polling_command_ = (this->last_polling_command_ + 1) % 15;
@@ -823,7 +775,7 @@ void Pipsolar::send_next_poll_() {
   this->state_ = STATE_POLL;
   this->command_start_millis_ = millis();
   this->empty_uart_buffer_();
-  this->read_pos_ = 0;
+  this->reset_read_buffer_();
   crc16 = calc_crc_(this->used_polling_commands_[this->last_polling_command_].command,
                     this->used_polling_commands_[this->last_polling_command_].length);
   this->write_array(this->used_polling_commands_[this->last_polling_command_].command,
@@ -839,19 +791,100 @@ void Pipsolar::send_next_poll_() {
 }
 
 void Pipsolar::queue_command_(const char *command, uint8_t length) {
+  if (length == 0 || length > COMMAND_MAX_LENGTH) {
+    ESP_LOGW(TAG, "Command length %u not supported, dropping command: %s", length, command);
+    return;
+  }
   uint8_t next_position = command_queue_position_;
   for (uint8_t i = 0; i < COMMAND_QUEUE_LENGTH; i++) {
     uint8_t testposition = (next_position + i) % COMMAND_QUEUE_LENGTH;
-    if (command_queue_[testposition].length() == 0) {
-      command_queue_[testposition] = command;
-      ESP_LOGD(TAG, "Command queued successfully: %s with length %u at position %d", command,
-               command_queue_[testposition].length(), testposition);
+    if (command_queue_[testposition][0] == '\0') {
+      memcpy(command_queue_[testposition], command, length);
+      command_queue_[testposition][length] = '\0';
+      ESP_LOGD(TAG, "Command queued successfully: %s with length %u at position %d", command, length, testposition);
       return;
     }
   }
   ESP_LOGD(TAG, "Command queue full dropping command: %s", command);
 }
 
+void Pipsolar::publish_sensor_(sensor::Sensor *sensor, float value) {
+  if (sensor == nullptr) {
+    return;
+  }
+  // most values only change every few polls, skip republishing them
+  if (!sensor->get_force_update() && sensor->has_state() && sensor->raw_state == value) {
+    return;
+  }
+  sensor->publish_state(value);
+}
+
+// Parses an optionally signed decimal number, the inverter never sends exponents
+static bool parse_decimal(const uint8_t *begin, const uint8_t *end, float *value) {
+  bool negative = false;
+  if (begin != end && (*begin == '-' || *begin == '+')) {
+    negative = *begin == '-';
+    begin++;
+  }
+  int32_t mantissa = 0;
+  int32_t divisor = 1;
+  bool digits = false;
+  bool fraction = false;
+  for (; begin != end; begin++) {
+    if (*begin == '.' && !fraction) {
+      fraction = true;
+      continue;
+    }
+    if (*begin < '0' || *begin > '9' || mantissa > 99999999) {
+      return false;
+    }
+    mantissa = mantissa * 10 + (*begin - '0');
+    if (fraction) {
+      divisor *= 10;
+    }
+    digits = true;
+  }
+  if (!digits) {
+    return false;
+  }
+  *value = (negative ? -mantissa : mantissa) / float(divisor);
+  return true;
+}
+
+bool Pipsolar::get_field_(uint8_t index, const uint8_t **begin, const uint8_t **end) const {
+  // the crc bytes and the trailing CR were already cut off by check_incoming_crc_()
+  const size_t payload_end = this->read_pos_ - 3;
+  if (index >= this->field_count_ || this->field_starts_[index] >= payload_end) {
+    return false;
+  }
+  size_t field_end = payload_end;
+  if (index + 1 < this->field_count_) {
+    // the next field starts right after the separating space
+    field_end = std::min<size_t>(field_end, this->field_starts_[index + 1] - 1);
+  }
+  *begin = this->read_buffer_ + this->field_starts_[index];
+  *end = this->read_buffer_ + field_end;
+  return true;
+}
+
+// Values of missing or malformed fields are kept, just like sscanf left them untouched
+template<typename T> void Pipsolar::parse_field_(uint8_t index, T &value) const {
+  const uint8_t *begin, *end;
+  float parsed;
+  if (this->get_field_(index, &begin, &end) && parse_decimal(begin, end, &parsed)) {
+    value = static_cast<T>(parsed);
+  } else {
+    ESP_LOGV(TAG, "Field %u missing or invalid", index);
+  }
+}
+
+template<typename T> void Pipsolar::parse_field_digit_(uint8_t index, uint8_t digit, T &value) const {
+  const uint8_t *begin, *end;
+  if (this->get_field_(index, &begin, &end) && digit < end - begin && begin[digit] >= '0' && begin[digit] <= '9') {
+    value = begin[digit] - '0';
+  }
+}
+
 void Pipsolar::switch_command(const std::string &command) {
   ESP_LOGD(TAG, "got command: %s", command.c_str());
   queue_command_(command.c_str(), command.length());
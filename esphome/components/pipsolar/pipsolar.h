@@ -186,7 +186,9 @@ class Pipsolar : public uart::UARTDevice, public PollingComponent {
 
  protected:
   static const size_t PIPSOLAR_READ_BUFFER_LENGTH = 110;  // maximum supported answer length
+  static const size_t PIPSOLAR_MAX_FIELDS = 32;           // QPIRI has the most fields (25)
   static const size_t COMMAND_QUEUE_LENGTH = 10;
+  static const size_t COMMAND_MAX_LENGTH = 15;
   static const size_t COMMAND_TIMEOUT = 5000;
   uint32_t last_poll_ = 0;
   void add_polling_command_(const char *command, ENUMPollingCommand polling_command);
@@ -198,12 +200,23 @@ class Pipsolar : public uart::UARTDevice, public PollingComponent {
   uint8_t send_next_command_();
   void send_next_poll_();
   void queue_command_(const char *command, uint8_t length);
-  std::string command_queue_[COMMAND_QUEUE_LENGTH];
+  void pop_command_();
+  void reset_read_buffer_();
+  bool get_field_(uint8_t index, const uint8_t **begin, const uint8_t **end) const;
+  template<typename T> void parse_field_(uint8_t index, T &value) const;
+  template<typename T> void parse_field_digit_(uint8_t index, uint8_t digit, T &value) const;
+  void publish_sensor_(sensor::Sensor *sensor, float value);
+  char command_queue_[COMMAND_QUEUE_LENGTH][COMMAND_MAX_LENGTH + 1]{};
   uint8_t command_queue_position_ = 0;
   uint8_t read_buffer_[PIPSOLAR_READ_BUFFER_LENGTH];
   size_t read_pos_{0};
+  // Offsets of the space separated response fields, recorded while the bytes arrive
+  uint8_t field_starts_[PIPSOLAR_MAX_FIELDS];
+  uint8_t field_count_{0};
 
   uint32_t command_start_millis_ = 0;
+  uint32_t round_trip_millis_ = 0;
+  uint32_t parse_micros_ = 0;
   uint8_t state_;
   enum State {
     STATE_IDLE = 0,
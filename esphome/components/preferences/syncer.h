@@ -10,9 +10,9 @@ class IntervalSyncer : public Component {
  public:
   void set_write_interval(uint32_t write_interval) { write_interval_ = write_interval; }
   void setup() override {
-    set_interval(write_interval_, []() { global_preferences->sync(); });
+    set_interval(write_interval_, []() { global_preferences->snapshot_and_sync(false); });
   }
-  void on_shutdown() override { global_preferences->sync(); }
+  void on_shutdown() override { global_preferences->snapshot_and_sync(true); }
   float get_setup_priority() const override { return setup_priority::BUS; }
 
  protected:
@@ -12,31 +12,51 @@ void PulseMeterSensor::setup() {
   this->pin_->attach_interrupt(PulseMeterSensor::gpio_intr, this, gpio::INTERRUPT_ANY_EDGE);
 
   this->last_detected_edge_us_ = 0;
-  this->last_valid_edge_us_ = 0;
+  this->window_open_ = false;
+  this->set_interval("stats", STATS_INTERVAL, [this]() { this->log_stats_(); });
+
+  // We need at least two pulses before we can measure anything
+  this->publish_state(0);
 }
 
 void PulseMeterSensor::loop() {
+  // Read the head before the time, so every edge we consume was timestamped before now
+  const uint32_t head = this->edge_ring_head_;
   const uint32_t now = micros();
 
+  // Drain the ring up to the snapshot, the ISR keeps appending behind it
+  while (this->edge_ring_tail_ != head) {
+    const uint32_t index = this->edge_ring_tail_ % EDGE_RING_SIZE;
+    const uint32_t edge_us = this->edge_ring_time_us_[index];
+    const uint32_t edge = this->edge_ring_sequence_[index];
+    this->edge_ring_tail_ = this->edge_ring_tail_ + 1;
+
+    this->max_edge_latency_us_ = std::max(this->max_edge_latency_us_, now - edge_us);
+    if (!this->window_open_) {
+      this->window_open_ = true;
+      this->window_start_us_ = edge_us;
+      this->window_start_edge_ = edge;
+    }
+    this->last_edge_us_ = edge_us;
+    this->last_edge_ = edge;
+  }
+
+  // Average over all pulses in the window, so edges arriving in bursts between two loops don't make the rate jitter
+  const uint32_t window_us = this->last_edge_us_ - this->window_start_us_;
+  if (this->window_open_ && this->last_edge_ != this->window_start_edge_ && window_us >= this->averaging_window_us_) {
+    const uint32_t pulses = this->last_edge_ - this->window_start_edge_;
+    this->publish_state((60.0f * 1000000.0f) * pulses / window_us);
+    this->window_start_us_ = this->last_edge_us_;
+    this->window_start_edge_ = this->last_edge_;
+  }
+
   // If we've exceeded our timeout interval without receiving any pulses, assume 0 pulses/min until
   // we get at least two valid pulses.
-  const uint32_t time_since_valid_edge_us = now - this->last_valid_edge_us_;
-  if ((this->last_valid_edge_us_ != 0) && (time_since_valid_edge_us > this->timeout_us_)) {
+  const uint32_t time_since_valid_edge_us = now - this->last_edge_us_;
+  if (this->window_open_ && time_since_valid_edge_us > this->timeout_us_) {
     ESP_LOGD(TAG, "No pulse detected for %us, assuming 0 pulses/min", time_since_valid_edge_us / 1000000);
-    this->last_valid_edge_us_ = 0;
-    this->pulse_width_us_ = 0;
-  }
-
-  // We quantize our pulse widths to 1 ms to avoid unnecessary jitter
-  const uint32_t pulse_width_ms = this->pulse_width_us_ / 1000;
-  if (this->pulse_width_dedupe_.next(pulse_width_ms)) {
-    if (pulse_width_ms == 0) {
-      // Treat 0 pulse width as 0 pulses/min (normally because we've not detected any pulses for a while)
-      this->publish_state(0);
-    } else {
-      // Calculate pulses/min from the pulse width in ms
-      this->publish_state((60.0f * 1000.0f) / pulse_width_ms);
-    }
+    this->window_open_ = false;
+    this->publish_state(0);
   }
 
   if (this->total_sensor_ != nullptr) {
@@ -49,11 +69,20 @@ void PulseMeterSensor::loop() {
 
 void PulseMeterSensor::set_total_pulses(uint32_t pulses) { this->total_pulses_ = pulses; }
 
+void PulseMeterSensor::log_stats_() {
+  // Dropped timestamps don't affect the rate, the sequence numbers still count every pulse
+  ESP_LOGV(TAG, "'%s': max ISR time %u µs, max edge latency %u µs, %u edge timestamps dropped",
+           this->get_name().c_str(), this->max_isr_time_us_, this->max_edge_latency_us_, this->dropped_edges_);
+}
+
 void PulseMeterSensor::dump_config() {
   LOG_SENSOR("", "Pulse Meter", this);
   LOG_PIN("  Pin: ", this->pin_);
   ESP_LOGCONFIG(TAG, "  Filtering pulses shorter than %u µs", this->filter_us_);
   ESP_LOGCONFIG(TAG, "  Assuming 0 pulses/min after not receiving a pulse for %us", this->timeout_us_ / 1000000);
+  if (this->averaging_window_us_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Averaging pulses over at least %u ms", this->averaging_window_us_ / 1000);
+  }
 }
 
 void IRAM_ATTR PulseMeterSensor::gpio_intr(PulseMeterSensor *sensor) {
@@ -69,16 +98,27 @@ void IRAM_ATTR PulseMeterSensor::gpio_intr(PulseMeterSensor *sensor) {
 
   // Check to see if we should filter this edge out
   if ((now - sensor->last_detected_edge_us_) >= sensor->filter_us_) {
-    // Don't measure the first valid pulse (we need at least two pulses to measure the width)
-    if (sensor->last_valid_edge_us_ != 0) {
-      sensor->pulse_width_us_ = (now - sensor->last_valid_edge_us_);
-    }
-
     sensor->total_pulses_++;
-    sensor->last_valid_edge_us_ = now;
+    const uint32_t edge = sensor->edge_sequence_ + 1;
+    sensor->edge_sequence_ = edge;
+
+    // Single producer ring, the loop only moves the tail so no locking is needed
+    const uint32_t head = sensor->edge_ring_head_;
+    if (head - sensor->edge_ring_tail_ < EDGE_RING_SIZE) {
+      sensor->edge_ring_time_us_[head % EDGE_RING_SIZE] = now;
+      sensor->edge_ring_sequence_[head % EDGE_RING_SIZE] = edge;
+      sensor->edge_ring_head_ = head + 1;
+    } else {
+      sensor->dropped_edges_++;
+    }
   }
 
   sensor->last_detected_edge_us_ = now;
+
+  const uint32_t isr_time_us = micros() - now;
+  if (isr_time_us > sensor->max_isr_time_us_) {
+    sensor->max_isr_time_us_ = isr_time_us;
+  }
 }
 
 }  // namespace pulse_meter
@@ -13,6 +13,7 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   void set_pin(InternalGPIOPin *pin) { this->pin_ = pin; }
   void set_filter_us(uint32_t filter) { this->filter_us_ = filter; }
   void set_timeout_us(uint32_t timeout) { this->timeout_us_ = timeout; }
+  void set_averaging_window_us(uint32_t window) { this->averaging_window_us_ = window; }
   void set_total_sensor(sensor::Sensor *sensor) { this->total_sensor_ = sensor; }
 
   void set_total_pulses(uint32_t pulses);
@@ -22,21 +23,49 @@ class PulseMeterSensor : public sensor::Sensor, public Component {
   float get_setup_priority() const override { return setup_priority::DATA; }
   void dump_config() override;
 
+  /// Edge timestamps the ISR discarded because the loop didn't empty the edge ring in time.
+  uint32_t get_dropped_edges() const { return this->dropped_edges_; }
+  /// Longest time spent in the interrupt handler.
+  uint32_t get_max_isr_time_us() const { return this->max_isr_time_us_; }
+  /// Longest time an edge waited in the ring before the loop picked it up.
+  uint32_t get_max_edge_latency_us() const { return this->max_edge_latency_us_; }
+
  protected:
+  // Must be a power of two so the free running ring indices wrap correctly
+  static const uint32_t EDGE_RING_SIZE = 64;
+  static const uint32_t STATS_INTERVAL = 60000;
+
   static void gpio_intr(PulseMeterSensor *sensor);
+  void log_stats_();
 
   InternalGPIOPin *pin_ = nullptr;
   ISRInternalGPIOPin isr_pin_;
   uint32_t filter_us_ = 0;
   uint32_t timeout_us_ = 1000000UL * 60UL * 5UL;
+  uint32_t averaging_window_us_ = 0;
   sensor::Sensor *total_sensor_ = nullptr;
 
-  Deduplicator<uint32_t> pulse_width_dedupe_;
   Deduplicator<uint32_t> total_dedupe_;
 
+  // Owned by the loop: the edge that opened the current averaging window and the newest edge seen
+  bool window_open_ = false;
+  uint32_t window_start_us_ = 0;
+  uint32_t window_start_edge_ = 0;
+  uint32_t last_edge_us_ = 0;
+  uint32_t last_edge_ = 0;
+  uint32_t max_edge_latency_us_ = 0;
+
+  // Written by the ISR only. Every valid edge gets a sequence number, so the loop still counts pulses
+  // correctly when timestamps are dropped because the ring was full.
+  volatile uint32_t edge_ring_time_us_[EDGE_RING_SIZE];
+  volatile uint32_t edge_ring_sequence_[EDGE_RING_SIZE];
+  volatile uint32_t edge_ring_head_ = 0;
+  volatile uint32_t edge_sequence_ = 0;
+  volatile uint32_t dropped_edges_ = 0;
+  volatile uint32_t max_isr_time_us_ = 0;
   volatile uint32_t last_detected_edge_us_ = 0;
-  volatile uint32_t last_valid_edge_us_ = 0;
-  volatile uint32_t pulse_width_us_ = 0;
+  // Advanced by the loop once it has consumed an edge
+  volatile uint32_t edge_ring_tail_ = 0;
   volatile uint32_t total_pulses_ = 0;
 };
 
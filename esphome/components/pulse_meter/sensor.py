@@ -20,6 +20,8 @@ from esphome.core import CORE
 
 CODEOWNERS = ["@stevebaxter"]
 
+CONF_AVERAGING_WINDOW = "averaging_window"
+
 pulse_meter_ns = cg.esphome_ns.namespace("pulse_meter")
 
 PulseMeterSensor = pulse_meter_ns.class_(
@@ -40,6 +42,13 @@ def validate_timeout(value):
     return value
 
 
+def validate_averaging_window(value):
+    value = cv.positive_time_period_microseconds(value)
+    if value.total_minutes > 70:
+        raise cv.Invalid("Maximum averaging window is 70 minutes")
+    return value
+
+
 def validate_pulse_meter_pin(value):
     value = pins.internal_gpio_input_pin_schema(value)
     if CORE.is_esp8266 and value[CONF_NUMBER] >= 16:
@@ -60,6 +69,7 @@ CONFIG_SCHEMA = sensor.sensor_schema(
         cv.Required(CONF_PIN): validate_pulse_meter_pin,
         cv.Optional(CONF_INTERNAL_FILTER, default="13us"): validate_internal_filter,
         cv.Optional(CONF_TIMEOUT, default="5min"): validate_timeout,
+        cv.Optional(CONF_AVERAGING_WINDOW, default="1s"): validate_averaging_window,
         cv.Optional(CONF_TOTAL): sensor.sensor_schema(
             unit_of_measurement=UNIT_PULSES,
             icon=ICON_PULSE,
@@ -79,6 +89,7 @@ async def to_code(config):
     cg.add(var.set_pin(pin))
     cg.add(var.set_filter_us(config[CONF_INTERNAL_FILTER]))
     cg.add(var.set_timeout_us(config[CONF_TIMEOUT]))
+    cg.add(var.set_averaging_window_us(config[CONF_AVERAGING_WINDOW]))
 
     if CONF_TOTAL in config:
         sens = await sensor.new_sensor(config[CONF_TOTAL])
@@ -56,32 +56,28 @@ class RemoteTransmitData {
 
 class RemoteReceiveData {
  public:
-  RemoteReceiveData(std::vector<int32_t> *data, uint8_t tolerance) : data_(data), tolerance_(tolerance) {}
+  RemoteReceiveData(std::vector<int32_t> *data, uint8_t tolerance)
+      : data_(data), lower_factor_(100 - tolerance), upper_factor_(100 + tolerance) {}
 
   bool peek_mark(uint32_t length, uint32_t offset = 0) {
     if (int32_t(this->index_ + offset) >= this->size())
       return false;
     int32_t value = this->peek(offset);
-    const int32_t lo = this->lower_bound_(length);
-    const int32_t hi = this->upper_bound_(length);
-    return value >= 0 && lo <= value && value <= hi;
+    return value >= 0 && this->in_range_(value, length);
   }
 
   bool peek_space(uint32_t length, uint32_t offset = 0) {
     if (int32_t(this->index_ + offset) >= this->size())
       return false;
     int32_t value = this->peek(offset);
-    const int32_t lo = this->lower_bound_(length);
-    const int32_t hi = this->upper_bound_(length);
-    return value <= 0 && lo <= -value && -value <= hi;
+    return value <= 0 && this->in_range_(-value, length);
   }
 
   bool peek_space_at_least(uint32_t length, uint32_t offset = 0) {
     if (int32_t(this->index_ + offset) >= this->size())
       return false;
     int32_t value = this->pos(this->index_ + offset);
-    const int32_t lo = this->lower_bound_(length);
-    return value <= 0 && lo <= -value;
+    return value <= 0 && this->at_least_(-value, length);
   }
 
   bool peek_item(uint32_t mark, uint32_t space, uint32_t offset = 0) {
@@ -137,12 +133,19 @@ class RemoteReceiveData {
   std::vector<int32_t> *get_raw_data() { return this->data_; }
 
  protected:
-  int32_t lower_bound_(uint32_t length) { return int32_t(100 - this->tolerance_) * length / 100U; }
-  int32_t upper_bound_(uint32_t length) { return int32_t(100 + this->tolerance_) * length / 100U; }
+  /* Every decoder tries every duration against its timings, so these run a lot. They give the same result as
+   * comparing against floor(length * (100 +- tolerance) / 100), but cross-multiply instead of dividing, which
+   * is a slow library call on the ESP8266.
+   */
+  bool at_least_(uint32_t value, uint32_t length) const { return this->lower_factor_ * length < 100 * value + 100; }
+  bool in_range_(uint32_t value, uint32_t length) const {
+    return this->at_least_(value, length) && 100 * value <= this->upper_factor_ * length;
+  }
 
   uint32_t index_{0};
   std::vector<int32_t> *data_;
-  uint8_t tolerance_;
+  uint32_t lower_factor_;
+  uint32_t upper_factor_;
 };
 
 template<typename T> class RemoteProtocol {
@@ -2,7 +2,15 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import pins
 from esphome.components import remote_base
-from esphome.const import CONF_CARRIER_DUTY_PERCENT, CONF_ID, CONF_PIN
+from esphome.const import (
+    CONF_CARRIER_DUTY_PERCENT,
+    CONF_ID,
+    CONF_OUTPUT,
+    CONF_PIN,
+    CONF_PLATFORM,
+)
+from esphome.core import CORE
+import esphome.final_validate as fv
 
 AUTO_LOAD = ["remote_base"]
 remote_transmitter_ns = cg.esphome_ns.namespace("remote_transmitter")
@@ -22,6 +30,21 @@ CONFIG_SCHEMA = cv.Schema(
 ).extend(cv.COMPONENT_SCHEMA)
 
 
+def validate_timer1(config):
+    # On ESP8266 codes are played from the only timer1 callback, ac_dimmer needs it too
+    if not CORE.is_esp8266:
+        return config
+    outputs = fv.full_config.get().get(CONF_OUTPUT, [])
+    if any(output[CONF_PLATFORM] == "ac_dimmer" for output in outputs):
+        raise cv.Invalid(
+            "remote_transmitter and ac_dimmer can not be used together on ESP8266"
+        )
+    return config
+
+
+FINAL_VALIDATE_SCHEMA = validate_timer1
+
+
 async def to_code(config):
     pin = await cg.gpio_pin_expression(config[CONF_PIN])
     var = cg.new_Pvariable(config[CONF_ID], pin)
@@ -1,8 +1,13 @@
 #pragma once
 
 #include "esphome/core/component.h"
+#include "esphome/core/helpers.h"
 #include "esphome/components/remote_base/remote_base.h"
 
+#ifdef USE_ESP8266
+#include <queue>
+#endif
+
 namespace esphome {
 namespace remote_transmitter {
 
@@ -24,18 +29,35 @@ class RemoteTransmitterComponent : public remote_base::RemoteTransmitterBase,
 
   void set_carrier_duty_percent(uint8_t carrier_duty_percent) { this->carrier_duty_percent_ = carrier_duty_percent; }
 
+  /// Called every time a transmission (including all repeats) has been sent completely.
+  void add_on_transmit_complete_callback(std::function<void()> &&callback) {
+    this->transmit_complete_callback_.add(std::move(callback));
+  }
+
+#ifdef USE_ESP8266
+  void loop() override;
+#endif
+
  protected:
   void send_internal(uint32_t send_times, uint32_t send_wait) override;
 #ifdef USE_ESP8266
-  void calculate_on_off_time_(uint32_t carrier_frequency, uint32_t *on_time_period, uint32_t *off_time_period);
+  struct PendingTransmit {
+    remote_base::RemoteTransmitData data;
+    uint32_t send_times;
+    uint32_t send_wait;
+  };
 
-  void mark_(uint32_t on_time, uint32_t off_time, uint32_t usec);
+  void calculate_on_off_time_(uint32_t carrier_frequency, uint32_t *on_time_period, uint32_t *off_time_period);
 
-  void space_(uint32_t usec);
+  /// Start playing the front transmission of the queue from the timer interrupt, if the timer is free.
+  void start_();
 
-  void await_target_time_();
-  uint32_t target_time_;
+  std::queue<PendingTransmit> queue_;
+  /// Whether the front transmission is being played by the timer interrupt
+  bool playing_{false};
+  ISRInternalGPIOPin isr_pin_;
 #endif
+  CallbackManager<void()> transmit_complete_callback_;
 
 #ifdef USE_ESP32
   void configure_rmt_();
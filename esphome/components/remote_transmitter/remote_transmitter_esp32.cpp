@@ -124,6 +124,7 @@ void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t sen
     if (i + 1 < send_times)
       delayMicroseconds(send_wait);
   }
+  this->transmit_complete_callback_.call();
 }
 
 }  // namespace remote_transmitter
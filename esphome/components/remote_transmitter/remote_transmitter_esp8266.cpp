@@ -1,17 +1,114 @@
 #include "remote_transmitter.h"
 #include "esphome/core/log.h"
-#include "esphome/core/application.h"
 
 #ifdef USE_ESP8266
 
+#include <core_esp8266_waveform.h>
+
 namespace esphome {
 namespace remote_transmitter {
 
 static const char *const TAG = "remote_transmitter";
 
+static const size_t MAX_QUEUED_TRANSMITS = 8;
+/// Events closer than this are waited for inside the interrupt instead of re-arming the timer
+static const int32_t TIMELINE_SPIN_US = 3;
+/// Re-arm interval while the finished timeline waits for loop() to release the timer
+static const uint32_t TIMELINE_IDLE_US = 10000;
+
+/// State of the transmission played from the timer1 interrupt. There is only one timer1 callback,
+/// so all transmitters share it and take turns.
+struct TimelinePlayer {
+  RemoteTransmitterComponent *owner;
+  ISRInternalGPIOPin pin;
+  const int32_t *data;
+  size_t size;
+  size_t index;
+  uint32_t repeat;
+  uint32_t send_times;
+  uint32_t send_wait;
+  uint32_t on_time;
+  uint32_t off_time;
+  /// micros() timestamp at which the current item ends
+  uint32_t item_end;
+  /// micros() timestamp of the next pin change, a carrier edge or item_end
+  uint32_t next_event;
+  bool started;
+  bool modulate;
+  bool carrier_high;
+  volatile bool done;
+
+  void start_item(uint32_t start);
+};
+
+static TimelinePlayer player{};  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+/// Begin the item after the current one at the scheduled time start, which may already have passed.
+/// Timing always follows the schedule so a late interrupt only shortens the pulse it delayed.
+void IRAM_ATTR HOT TimelinePlayer::start_item(uint32_t start) {
+  if (this->index == this->size) {
+    // end of frame
+    this->pin.digital_write(false);
+    this->modulate = false;
+    this->index = 0;
+    if (++this->repeat >= this->send_times) {
+      this->done = true;
+      return;
+    }
+    if (this->send_wait > 0) {
+      this->item_end = this->next_event = start + this->send_wait;
+      return;
+    }
+  }
+  const int32_t item = this->data[this->index++];
+  if (item > 0) {
+    this->pin.digital_write(true);
+    this->item_end = start + uint32_t(item);
+    this->modulate = this->off_time > 0;
+    this->carrier_high = true;
+    this->next_event = this->modulate ? start + this->on_time : this->item_end;
+    if (static_cast<int32_t>(this->next_event - this->item_end) > 0)
+      this->next_event = this->item_end;
+  } else {
+    this->pin.digital_write(false);
+    this->modulate = false;
+    this->item_end = this->next_event = start + uint32_t(-item);
+  }
+}
+
+/// Run timer interrupt code and return in how many µs the next event is expected
+uint32_t IRAM_ATTR HOT timeline_interrupt() {
+  TimelinePlayer &p = player;
+  if (!p.started) {
+    // A running timer only picks up a new callback at its next scheduled event, so start the timeline from here
+    p.started = true;
+    p.item_end = p.next_event = micros();
+  }
+  while (!p.done) {
+    const int32_t remaining = static_cast<int32_t>(p.next_event - micros());
+    if (remaining > TIMELINE_SPIN_US)
+      return remaining - TIMELINE_SPIN_US;
+    while (static_cast<int32_t>(p.next_event - micros()) > 0) {
+      // too close to re-arm the timer, wait for the edge here
+    }
+    if (p.modulate && p.next_event != p.item_end) {
+      // carrier edge inside a mark
+      p.carrier_high = !p.carrier_high;
+      p.pin.digital_write(p.carrier_high);
+      p.next_event += p.carrier_high ? p.on_time : p.off_time;
+      if (static_cast<int32_t>(p.next_event - p.item_end) > 0)
+        p.next_event = p.item_end;
+    } else {
+      p.start_item(p.item_end);
+    }
+  }
+  return TIMELINE_IDLE_US;
+}
+
 void RemoteTransmitterComponent::setup() {
   this->pin_->setup();
   this->pin_->digital_write(false);
+  this->isr_pin_ = this->pin_->to_isr();
 }
 
 void RemoteTransmitterComponent::dump_config() {
@@ -33,66 +130,57 @@ void RemoteTransmitterComponent::calculate_on_off_time_(uint32_t carrier_frequen
   *off_time_period = period - *on_time_period;
 }
 
-void RemoteTransmitterComponent::await_target_time_() {
-  const uint32_t current_time = micros();
-  if (this->target_time_ == 0) {
-    this->target_time_ = current_time;
-  } else if (this->target_time_ > current_time) {
-    delayMicroseconds(this->target_time_ - current_time);
+void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
+  if (this->queue_.size() >= MAX_QUEUED_TRANSMITS) {
+    ESP_LOGW(TAG, "Transmit queue full, dropping remote code");
+    return;
   }
+  // temp_ is reused by the next transmit() call, so the queue keeps its own copy
+  this->queue_.push(PendingTransmit{this->temp_, send_times, send_wait});
+  if (!this->playing_)
+    this->start_();
 }
 
-void RemoteTransmitterComponent::mark_(uint32_t on_time, uint32_t off_time, uint32_t usec) {
-  this->await_target_time_();
-  this->pin_->digital_write(true);
-
-  const uint32_t target = this->target_time_ + usec;
-  if (this->carrier_duty_percent_ < 100 && (on_time > 0 || off_time > 0)) {
-    while (true) {  // Modulate with carrier frequency
-      this->target_time_ += on_time;
-      if (this->target_time_ >= target)
-        break;
-      this->await_target_time_();
-      this->pin_->digital_write(false);
-
-      this->target_time_ += off_time;
-      if (this->target_time_ >= target)
-        break;
-      this->await_target_time_();
-      this->pin_->digital_write(true);
-    }
+void RemoteTransmitterComponent::start_() {
+  if (player.owner != nullptr)
+    return;  // another transmitter is using the timer, loop() tries again
+  const PendingTransmit &transmit = this->queue_.front();
+  ESP_LOGD(TAG, "Sending remote code...");
+  if (transmit.data.get_data().empty() || transmit.send_times == 0) {
+    this->queue_.pop();
+    this->transmit_complete_callback_.call();
+    return;
   }
-  this->target_time_ = target;
+  // The queue never moves its front element, so the data stays valid until loop() pops it
+  player.owner = this;
+  player.pin = this->isr_pin_;
+  player.data = transmit.data.get_data().data();
+  player.size = transmit.data.get_data().size();
+  player.index = 0;
+  player.repeat = 0;
+  player.send_times = transmit.send_times;
+  player.send_wait = transmit.send_wait;
+  this->calculate_on_off_time_(transmit.data.get_carrier_frequency(), &player.on_time, &player.off_time);
+  player.started = false;
+  player.modulate = false;
+  player.done = false;
+  this->playing_ = true;
+  // Uses ESP8266 waveform (soft PWM) class, so PWM outputs keep running while a code is sent
+  setTimer1Callback(&timeline_interrupt);
 }
 
-void RemoteTransmitterComponent::space_(uint32_t usec) {
-  this->await_target_time_();
-  this->pin_->digital_write(false);
-  this->target_time_ += usec;
-}
-
-void RemoteTransmitterComponent::send_internal(uint32_t send_times, uint32_t send_wait) {
-  ESP_LOGD(TAG, "Sending remote code...");
-  uint32_t on_time, off_time;
-  this->calculate_on_off_time_(this->temp_.get_carrier_frequency(), &on_time, &off_time);
-  this->target_time_ = 0;
-  for (uint32_t i = 0; i < send_times; i++) {
-    for (int32_t item : this->temp_.get_data()) {
-      if (item > 0) {
-        const auto length = uint32_t(item);
-        this->mark_(on_time, off_time, length);
-      } else {
-        const auto length = uint32_t(-item);
-        this->space_(length);
-      }
-      App.feed_wdt();
-    }
-    this->await_target_time_();  // wait for duration of last pulse
-    this->pin_->digital_write(false);
-
-    if (i + 1 < send_times)
-      this->target_time_ += send_wait;
+void RemoteTransmitterComponent::loop() {
+  if (this->playing_) {
+    if (!player.done)
+      return;
+    setTimer1Callback(nullptr);
+    player.owner = nullptr;
+    this->playing_ = false;
+    this->queue_.pop();
+    this->transmit_complete_callback_.call();
   }
+  if (!this->queue_.empty())
+    this->start_();
 }
 
 }  // namespace remote_transmitter
@@ -1,6 +1,8 @@
 #include "sun.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 /*
 The formulas/algorithms in this module are based on the book
 "Astronomical algorithms" by Jean Meeus (2nd edition)
@@ -18,6 +20,13 @@ using namespace esphome::sun::internal;
 
 static const char *const TAG = "sun";
 
+// Elevation/azimuth are interpolated between exact values this many seconds apart
+static const time_t COORDS_INTERVAL = 300;
+static const double MAX_INTERPOLATED_ELEVATION = 85;
+static const size_t MAX_CACHED_EVENTS = 16;
+static const uint32_t TRIGGER_RETRY_DELAY = 60 * 1000;
+static const uint32_t TRIGGER_MAX_DELAY = 60 * 60 * 1000;
+
 #undef PI
 #undef degrees
 #undef radians
@@ -274,11 +283,9 @@ struct SunAtLocation {
   }
 };
 
-HorizontalCoordinate Sun::calc_coords_() {
+HorizontalCoordinate Sun::true_coords_at_(time_t timestamp) {
   SunAtLocation sun{location_};
-  Moment m{time_->utcnow()};
-  if (!m.dt.is_valid())
-    return HorizontalCoordinate{NAN, NAN};
+  Moment m{time::ESPTime::from_epoch_utc(timestamp)};
 
   // uncomment to print some debug output
   /*
@@ -287,8 +294,56 @@ HorizontalCoordinate Sun::calc_coords_() {
   */
   return sun.true_coordinate(m);
 }
-optional<time::ESPTime> Sun::calc_event_(bool rising, double zenith) {
+HorizontalCoordinate Sun::calc_coords_() {
+  auto now = this->time_->utcnow();
+  if (!now.is_valid())
+    return HorizontalCoordinate{NAN, NAN};
+
+  time_t start = now.timestamp - now.timestamp % COORDS_INTERVAL;
+  if (start != this->coords_start_) {
+    if (start == this->coords_start_ + COORDS_INTERVAL) {
+      this->coords_[0] = this->coords_[1];
+    } else {
+      this->coords_[0] = this->true_coords_at_(start);
+    }
+    this->coords_[1] = this->true_coords_at_(start + COORDS_INTERVAL);
+    this->coords_start_ = start;
+  }
+
+  const HorizontalCoordinate &from = this->coords_[0];
+  const HorizontalCoordinate &to = this->coords_[1];
+  if (from.elevation > MAX_INTERPOLATED_ELEVATION || to.elevation > MAX_INTERPOLATED_ELEVATION) {
+    // Close to the zenith the azimuth swings too fast for linear interpolation
+    return this->true_coords_at_(now.timestamp);
+  }
+  num_t f = num_t(now.timestamp - start) / COORDS_INTERVAL;
+  num_t azimuth_delta = to.azimuth - from.azimuth;
+  if (azimuth_delta > 180) {
+    azimuth_delta -= 360;
+  } else if (azimuth_delta < -180) {
+    azimuth_delta += 360;
+  }
+  return HorizontalCoordinate{from.elevation + (to.elevation - from.elevation) * f,
+                              wmod(from.azimuth + azimuth_delta * f, 360)};
+}
+optional<time::ESPTime> Sun::event_on_day_(bool rising, double zenith, const time::ESPTime &day) {
+  for (auto &entry : this->event_cache_) {
+    if (entry.rising == rising && entry.zenith == zenith && entry.day == day.timestamp)
+      return entry.event;
+  }
+
   SunAtLocation sun{location_};
+  auto event = sun.event(rising, day, zenith);
+  // Only today's and tomorrow's events are asked for, drop the ones of past days
+  this->event_cache_.erase(std::remove_if(this->event_cache_.begin(), this->event_cache_.end(),
+                                          [&day](const EventCacheEntry &entry) { return entry.day < day.timestamp; }),
+                           this->event_cache_.end());
+  if (this->event_cache_.size() >= MAX_CACHED_EVENTS)
+    this->event_cache_.erase(this->event_cache_.begin());
+  this->event_cache_.push_back(EventCacheEntry{rising, zenith, day.timestamp, event});
+  return event;
+}
+optional<time::ESPTime> Sun::calc_event_(bool rising, double zenith) {
   auto now = this->time_->utcnow();
   if (!now.is_valid())
     return {};
@@ -297,21 +352,51 @@ optional<time::ESPTime> Sun::calc_event_(bool rising, double zenith) {
   today.hour = today.minute = today.second = 0;
   today.recalc_timestamp_utc();
 
-  auto it = sun.event(rising, today, zenith);
+  auto it = this->event_on_day_(rising, zenith, today);
   if (it.has_value() && it->timestamp < now.timestamp) {
     // We're calculating *next* sunrise/sunset, but calculated event
     // is today, so try again tomorrow
     time_t new_timestamp = today.timestamp + 24 * 60 * 60;
     today = time::ESPTime::from_epoch_utc(new_timestamp);
-    it = sun.event(rising, today, zenith);
+    it = this->event_on_day_(rising, zenith, today);
   }
   return it;
 }
+void Sun::invalidate_cache_() {
+  this->event_cache_.clear();
+  this->coords_start_ = 0;
+}
 
 optional<time::ESPTime> Sun::sunrise(double elevation) { return this->calc_event_(true, 90 - elevation); }
 optional<time::ESPTime> Sun::sunset(double elevation) { return this->calc_event_(false, 90 - elevation); }
 double Sun::elevation() { return this->calc_coords_().elevation; }
 double Sun::azimuth() { return this->calc_coords_().azimuth; }
 
+void SunTrigger::schedule_() {
+  optional<time::ESPTime> event;
+  auto now = this->parent_->get_time()->utcnow();
+  if (now.is_valid()) {
+    event = this->sunrise_ ? this->parent_->sunrise(this->elevation_) : this->parent_->sunset(this->elevation_);
+  }
+  if (!event.has_value()) {
+    // No valid time yet, or the sun doesn't reach this elevation today (polar day/night)
+    this->set_timeout("event", TRIGGER_RETRY_DELAY, [this]() { this->schedule_(); });
+    return;
+  }
+
+  uint32_t delay = std::max<time_t>(event->timestamp - now.timestamp, 0) * 1000;
+  if (delay > TRIGGER_MAX_DELAY) {
+    // Look again later instead, the clock may still be synced or shift for DST until then
+    this->set_timeout("event", TRIGGER_MAX_DELAY, [this]() { this->schedule_(); });
+    return;
+  }
+  ESP_LOGD(TAG, "Next %s in %us", this->sunrise_ ? "sunrise" : "sunset", delay / 1000);
+  this->set_timeout("event", delay, [this]() {
+    this->trigger();
+    // Wait until the event has passed, so the next one computed is tomorrow's
+    this->set_timeout("event", TRIGGER_RETRY_DELAY, [this]() { this->schedule_(); });
+  });
+}
+
 }  // namespace sun
 }  // namespace esphome
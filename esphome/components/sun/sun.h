@@ -54,8 +54,14 @@ class Sun {
  public:
   void set_time(time::RealTimeClock *time) { time_ = time; }
   time::RealTimeClock *get_time() const { return time_; }
-  void set_latitude(double latitude) { location_.latitude = latitude; }
-  void set_longitude(double longitude) { location_.longitude = longitude; }
+  void set_latitude(double latitude) {
+    location_.latitude = latitude;
+    this->invalidate_cache_();
+  }
+  void set_longitude(double longitude) {
+    location_.longitude = longitude;
+    this->invalidate_cache_();
+  }
 
   optional<time::ESPTime> sunrise(double elevation);
   optional<time::ESPTime> sunset(double elevation);
@@ -64,41 +70,40 @@ class Sun {
   double azimuth();
 
  protected:
+  struct EventCacheEntry {
+    bool rising;
+    double zenith;
+    time_t day;
+    optional<time::ESPTime> event;
+  };
+
   internal::HorizontalCoordinate calc_coords_();
+  internal::HorizontalCoordinate true_coords_at_(time_t timestamp);
   optional<time::ESPTime> calc_event_(bool rising, double zenith);
+  optional<time::ESPTime> event_on_day_(bool rising, double zenith, const time::ESPTime &day);
+  void invalidate_cache_();
 
   time::RealTimeClock *time_;
   internal::GeoLocation location_;
+  /// Events only change once a day, shared by all triggers and text sensors
+  std::vector<EventCacheEntry> event_cache_;
+  /// Exact coordinates at the bounds of the interval the last query fell into, interpolated in between
+  time_t coords_start_{0};
+  internal::HorizontalCoordinate coords_[2];
 };
 
-class SunTrigger : public Trigger<>, public PollingComponent, public Parented<Sun> {
+/// Fires at the next sunrise/sunset, armed through the scheduler instead of polling the elevation.
+class SunTrigger : public Trigger<>, public Component, public Parented<Sun> {
  public:
-  SunTrigger() : PollingComponent(60000) {}
-
   void set_sunrise(bool sunrise) { sunrise_ = sunrise; }
   void set_elevation(double elevation) { elevation_ = elevation; }
 
-  void update() override {
-    double current = this->parent_->elevation();
-    if (std::isnan(current))
-      return;
-
-    bool crossed;
-    if (this->sunrise_) {
-      crossed = this->last_elevation_ <= this->elevation_ && this->elevation_ < current;
-    } else {
-      crossed = this->last_elevation_ >= this->elevation_ && this->elevation_ > current;
-    }
-
-    if (crossed && !std::isnan(this->last_elevation_)) {
-      this->trigger();
-    }
-    this->last_elevation_ = current;
-  }
+  void setup() override { this->schedule_(); }
 
  protected:
+  void schedule_();
+
   bool sunrise_;
-  double last_elevation_{NAN};
   double elevation_;
 };
 
@@ -4,6 +4,7 @@ from esphome import automation
 from esphome.components import mqtt
 from esphome.const import (
     CONF_FILTERS,
+    CONF_FORCE_UPDATE,
     CONF_ID,
     CONF_ON_VALUE,
     CONF_ON_RAW_VALUE,
@@ -117,6 +118,9 @@ TEXT_SENSOR_SCHEMA = cv.ENTITY_BASE_SCHEMA.extend(cv.MQTT_COMPONENT_SCHEMA).exte
     {
         cv.OnlyWith(CONF_MQTT_ID, "mqtt"): cv.declare_id(mqtt.MQTTTextSensor),
         cv.Optional(CONF_FILTERS): validate_filters,
+        # Repeated raw values are dropped before the filters, so on_raw_value and
+        # on_value only fire for repeated values with force_update enabled.
+        cv.Optional(CONF_FORCE_UPDATE, default=False): cv.boolean,
         cv.Optional(CONF_ON_VALUE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(TextSensorStateTrigger),
@@ -140,6 +144,9 @@ async def build_filters(config):
 async def setup_text_sensor_core_(var, config):
     await setup_entity(var, config)
 
+    if config[CONF_FORCE_UPDATE]:
+        cg.add(var.set_force_update(True))
+
     if config.get(CONF_FILTERS):  # must exist and not be empty
         filters = await build_filters(config[CONF_FILTERS])
         cg.add(var.set_filters(filters))
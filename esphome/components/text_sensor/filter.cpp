@@ -9,19 +9,19 @@ namespace text_sensor {
 static const char *const TAG = "text_sensor.filter";
 
 // Filter
-void Filter::input(const std::string &value) {
+void Filter::input(std::string value) {
   ESP_LOGVV(TAG, "Filter(%p)::input(%s)", this, value.c_str());
-  optional<std::string> out = this->new_value(value);
+  optional<std::string> out = this->new_value(std::move(value));
   if (out.has_value())
-    this->output(*out);
+    this->output(std::move(*out));
 }
-void Filter::output(const std::string &value) {
+void Filter::output(std::string value) {
   if (this->next_ == nullptr) {
     ESP_LOGVV(TAG, "Filter(%p)::output(%s) -> SENSOR", this, value.c_str());
     this->parent_->internal_send_state_to_frontend(value);
   } else {
     ESP_LOGVV(TAG, "Filter(%p)::output(%s) -> %p", this, value.c_str(), this->next_);
-    this->next_->input(value);
+    this->next_->input(std::move(value));
   }
 }
 void Filter::initialize(TextSensor *parent, Filter *next) {
@@ -56,10 +56,16 @@ optional<std::string> ToLowerFilter::new_value(std::string value) {
 }
 
 // Append
-optional<std::string> AppendFilter::new_value(std::string value) { return value + this->suffix_; }
+optional<std::string> AppendFilter::new_value(std::string value) {
+  value += this->suffix_;
+  return value;
+}
 
 // Prepend
-optional<std::string> PrependFilter::new_value(std::string value) { return this->prefix_ + value; }
+optional<std::string> PrependFilter::new_value(std::string value) {
+  value.insert(0, this->prefix_);
+  return value;
+}
 
 // Substitute
 optional<std::string> SubstituteFilter::new_value(std::string value) {
@@ -32,9 +32,9 @@ class Filter {
   /// Initialize this filter, please note this can be called more than once.
   virtual void initialize(TextSensor *parent, Filter *next);
 
-  void input(const std::string &value);
+  void input(std::string value);
 
-  void output(const std::string &value);
+  void output(std::string value);
 
  protected:
   friend TextSensor;
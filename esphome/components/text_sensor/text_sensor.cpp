@@ -10,6 +10,11 @@ TextSensor::TextSensor() : TextSensor("") {}
 TextSensor::TextSensor(const std::string &name) : EntityBase(name) {}
 
 void TextSensor::publish_state(const std::string &state) {
+  if (!this->force_update_ && this->has_state_ && state == this->raw_state) {
+    ESP_LOGV(TAG, "'%s': State unchanged, skipping", this->name_.c_str());
+    return;
+  }
+
   this->raw_state = state;
   this->raw_callback_.call(state);
 
@@ -18,6 +23,7 @@ void TextSensor::publish_state(const std::string &state) {
   if (this->filter_list_ == nullptr) {
     this->internal_send_state_to_frontend(state);
   } else {
+    // The filters get their own copy to modify, it's moved along the chain from there
     this->filter_list_->input(state);
   }
 }
@@ -52,20 +58,22 @@ void TextSensor::clear_filters() {
   this->filter_list_ = nullptr;
 }
 
-void TextSensor::add_on_state_callback(std::function<void(std::string)> callback) {
+void TextSensor::add_on_state_callback(std::function<void(const std::string &)> callback) {
   this->callback_.add(std::move(callback));
 }
-void TextSensor::add_on_raw_state_callback(std::function<void(std::string)> callback) {
+void TextSensor::add_on_raw_state_callback(std::function<void(const std::string &)> callback) {
   this->raw_callback_.add(std::move(callback));
 }
 
 std::string TextSensor::get_state() const { return this->state; }
 std::string TextSensor::get_raw_state() const { return this->raw_state; }
 void TextSensor::internal_send_state_to_frontend(const std::string &state) {
+  // Assigning reuses the existing buffer when it's large enough
   this->state = state;
   this->has_state_ = true;
   ESP_LOGD(TAG, "'%s': Sending state '%s'", this->name_.c_str(), state.c_str());
-  this->callback_.call(state);
+  // All listeners get a reference to the stored state instead of their own copy
+  this->callback_.call(this->state);
 }
 
 std::string TextSensor::unique_id() { return ""; }
@@ -29,8 +29,16 @@ class TextSensor : public EntityBase {
   /// Getter-syntax for .raw_state
   std::string get_raw_state() const;
 
+  /// Publish a new state, skipped if it equals the last raw state unless force_update is set.
   void publish_state(const std::string &state);
 
+  /** Publish every state, even if it didn't change.
+   *
+   * Without force_update, a state equal to the last raw state is dropped before the filters, so neither the
+   * on_raw_value nor the on_value triggers fire for it.
+   */
+  void set_force_update(bool force_update) { this->force_update_ = force_update; }
+
   /// Add a filter to the filter chain. Will be appended to the back.
   void add_filter(Filter *filter);
 
@@ -43,9 +51,10 @@ class TextSensor : public EntityBase {
   /// Clear the entire filter chain.
   void clear_filters();
 
-  void add_on_state_callback(std::function<void(std::string)> callback);
+  /// Add a callback that will be called every time a filtered value is sent. The state is only valid during the call.
+  void add_on_state_callback(std::function<void(const std::string &)> callback);
   /// Add a callback that will be called every time the sensor sends a raw value.
-  void add_on_raw_state_callback(std::function<void(std::string)> callback);
+  void add_on_raw_state_callback(std::function<void(const std::string &)> callback);
 
   std::string state;
   std::string raw_state;
@@ -61,12 +70,13 @@ class TextSensor : public EntityBase {
  protected:
   uint32_t hash_base() override;
 
-  CallbackManager<void(std::string)> raw_callback_;  ///< Storage for raw state callbacks.
-  CallbackManager<void(std::string)> callback_;      ///< Storage for filtered state callbacks.
+  CallbackManager<void(const std::string &)> raw_callback_;  ///< Storage for raw state callbacks.
+  CallbackManager<void(const std::string &)> callback_;      ///< Storage for filtered state callbacks.
 
   Filter *filter_list_{nullptr};  ///< Store all active filters.
 
   bool has_state_{false};
+  bool force_update_{false};
 };
 
 }  // namespace text_sensor
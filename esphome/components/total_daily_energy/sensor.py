@@ -18,6 +18,7 @@ DEPENDENCIES = ["time"]
 
 CONF_POWER_ID = "power_id"
 CONF_MIN_SAVE_INTERVAL = "min_save_interval"
+CONF_USE_RAW_VALUES = "use_raw_values"
 total_daily_energy_ns = cg.esphome_ns.namespace("total_daily_energy")
 TotalDailyEnergyMethod = total_daily_energy_ns.enum("TotalDailyEnergyMethod")
 TOTAL_DAILY_ENERGY_METHODS = {
@@ -55,6 +56,7 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_METHOD, default="right"): cv.enum(
                 TOTAL_DAILY_ENERGY_METHODS, lower=True
             ),
+            cv.Optional(CONF_USE_RAW_VALUES, default=False): cv.boolean,
         }
     )
     .extend(cv.COMPONENT_SCHEMA)
@@ -94,3 +96,4 @@ async def to_code(config):
     cg.add(var.set_restore(config[CONF_RESTORE]))
     cg.add(var.set_min_save_interval(config[CONF_MIN_SAVE_INTERVAL]))
     cg.add(var.set_method(config[CONF_METHOD]))
+    cg.add(var.set_use_raw_values(config[CONF_USE_RAW_VALUES]))
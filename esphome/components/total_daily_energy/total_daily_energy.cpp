@@ -10,15 +10,18 @@ void TotalDailyEnergy::setup() {
   float initial_value = 0;
 
   if (this->restore_) {
-    this->pref_ = global_preferences->make_preference<float>(this->get_object_id_hash());
-    this->pref_.load(&initial_value);
+    this->pref_.setup(global_preferences->make_preference<float>(this->get_object_id_hash()), this->min_save_interval_,
+                      &initial_value);
   }
   this->publish_state_and_save(initial_value);
 
   this->last_update_ = millis();
-  this->last_save_ = this->last_update_;
 
-  this->parent_->add_on_state_callback([this](float state) { this->process_new_state_(state); });
+  if (this->use_raw_values_) {
+    this->parent_->add_on_raw_state_callback([this](float state) { this->process_new_state_(state); });
+  } else {
+    this->parent_->add_on_state_callback([this](float state) { this->process_new_state_(state); });
+  }
 }
 
 void TotalDailyEnergy::dump_config() { LOG_SENSOR("", "Total Daily Energy", this); }
@@ -35,20 +38,14 @@ void TotalDailyEnergy::loop() {
 
   if (t.day_of_year != this->last_day_of_year_) {
     this->last_day_of_year_ = t.day_of_year;
-    this->total_energy_ = 0;
     this->publish_state_and_save(0);
   }
 }
 
 void TotalDailyEnergy::publish_state_and_save(float state) {
-  this->total_energy_ = state;
+  this->total_energy_.reset(state);
   this->publish_state(state);
-  const uint32_t now = millis();
-  if (now - this->last_save_ < this->min_save_interval_) {
-    return;
-  }
-  this->last_save_ = now;
-  this->pref_.save(&state);
+  this->pref_.update(state);
 }
 
 void TotalDailyEnergy::process_new_state_(float state) {
@@ -57,8 +54,8 @@ void TotalDailyEnergy::process_new_state_(float state) {
   const uint32_t now = millis();
   const float old_state = this->last_power_state_;
   const float new_state = state;
-  float delta_hours = (now - this->last_update_) / 1000.0f / 60.0f / 60.0f;
-  float delta_energy = 0.0f;
+  const double delta_hours = (now - this->last_update_) / 3600000.0;
+  double delta_energy = 0.0;
   switch (this->method_) {
     case TOTAL_DAILY_ENERGY_METHOD_TRAPEZOID:
       delta_energy = delta_hours * (old_state + new_state) / 2.0;
@@ -72,7 +69,9 @@ void TotalDailyEnergy::process_new_state_(float state) {
   }
   this->last_power_state_ = new_state;
   this->last_update_ = now;
-  this->publish_state_and_save(this->total_energy_ + delta_energy);
+  this->total_energy_.add(delta_energy);
+  this->publish_state(this->total_energy_.value());
+  this->pref_.update(this->total_energy_.value());
 }
 
 }  // namespace total_daily_energy
@@ -22,6 +22,7 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
   void set_time(time::RealTimeClock *time) { time_ = time; }
   void set_parent(Sensor *parent) { parent_ = parent; }
   void set_method(TotalDailyEnergyMethod method) { method_ = method; }
+  void set_use_raw_values(bool use_raw_values) { use_raw_values_ = use_raw_values; }
   void setup() override;
   void dump_config() override;
   float get_setup_priority() const override { return setup_priority::DATA; }
@@ -32,16 +33,16 @@ class TotalDailyEnergy : public sensor::Sensor, public Component {
  protected:
   void process_new_state_(float state);
 
-  ESPPreferenceObject pref_;
+  ThrottledPreference<float> pref_;
   time::RealTimeClock *time_;
   Sensor *parent_;
   TotalDailyEnergyMethod method_;
   uint16_t last_day_of_year_{};
   uint32_t last_update_{0};
-  uint32_t last_save_{0};
   uint32_t min_save_interval_{0};
   bool restore_;
-  float total_energy_{0.0f};
+  bool use_raw_values_{false};
+  CompensatedSum total_energy_;
   float last_power_state_{0.0f};
 };
 
@@ -326,7 +326,7 @@ void Tuya::handle_datapoint_(const uint8_t *buffer, size_t len) {
   }
 }
 
-void Tuya::send_raw_command_(TuyaCommand command) {
+void Tuya::send_raw_command_(const TuyaCommand &command) {
   uint8_t len_hi = (uint8_t)(command.payload.size() >> 8);
   uint8_t len_lo = (uint8_t)(command.payload.size() & 0xFF);
   uint8_t version = 0;
@@ -358,7 +358,7 @@ void Tuya::send_raw_command_(TuyaCommand command) {
     this->write_array(command.payload.data(), command.payload.size());
 
   uint8_t checksum = 0x55 + 0xAA + (uint8_t) command.cmd + len_hi + len_lo;
-  for (auto &data : command.payload)
+  for (auto data : command.payload)
     checksum += data;
   this->write_byte(checksum);
 }
@@ -376,16 +376,60 @@ void Tuya::process_command_queue_() {
   }
 
   // Left check of delay since last command in case there's ever a command sent by calling send_raw_command_ directly
-  if (delay > COMMAND_DELAY && !this->command_queue_.empty() && this->rx_message_.empty() &&
+  if (delay > COMMAND_DELAY && this->command_queue_count_ > 0 && this->rx_message_.empty() &&
       !this->expected_response_.has_value()) {
-    this->send_raw_command_(command_queue_.front());
-    this->command_queue_.erase(command_queue_.begin());
+    this->send_raw_command_(this->command_queue_[this->command_queue_head_]);
+    this->command_queue_head_ = (this->command_queue_head_ + 1) % COMMAND_QUEUE_SIZE;
+    this->command_queue_count_--;
   }
 }
 
+int Tuya::find_queued_datapoint_command_(uint8_t datapoint_id) {
+  for (uint8_t i = 0; i < this->command_queue_count_; i++) {
+    const TuyaCommand &queued = this->command_queue_[(this->command_queue_head_ + i) % COMMAND_QUEUE_SIZE];
+    if (queued.cmd == TuyaCommandType::DATAPOINT_DELIVER && !queued.payload.empty() &&
+        queued.payload[0] == datapoint_id)
+      return i;
+  }
+  return -1;
+}
+
 void Tuya::send_command_(const TuyaCommand &command) {
-  command_queue_.push_back(command);
-  process_command_queue_();
+  // A newer write to a datapoint supersedes the pending one, so fast changes (e.g. from a slider) don't pile up
+  // behind each other. The write is only merged in place when it's the last queued command, otherwise it would
+  // overtake commands that were queued after the older write.
+  if (command.cmd == TuyaCommandType::DATAPOINT_DELIVER && !command.payload.empty()) {
+    int pos = this->find_queued_datapoint_command_(command.payload[0]);
+    if (pos >= 0 && pos == this->command_queue_count_ - 1) {
+      ESP_LOGV(TAG, "Replacing queued write to datapoint %u", command.payload[0]);
+      TuyaCommand &queued = this->command_queue_[(this->command_queue_head_ + pos) % COMMAND_QUEUE_SIZE];
+      queued.payload.assign(command.payload.begin(), command.payload.end());
+      this->process_command_queue_();
+      return;
+    }
+    if (pos >= 0) {
+      ESP_LOGV(TAG, "Moving queued write to datapoint %u to the end of the queue", command.payload[0]);
+      // Shift the later commands forward, the stale write ends up in the tail slot that's reused below
+      for (int i = pos; i < this->command_queue_count_ - 1; i++) {
+        std::swap(this->command_queue_[(this->command_queue_head_ + i) % COMMAND_QUEUE_SIZE],
+                  this->command_queue_[(this->command_queue_head_ + i + 1) % COMMAND_QUEUE_SIZE]);
+      }
+      this->command_queue_count_--;
+    }
+  }
+
+  if (this->command_queue_count_ == COMMAND_QUEUE_SIZE) {
+    ESP_LOGW(TAG, "Command queue full, dropping oldest command 0x%02X",
+             static_cast<uint8_t>(this->command_queue_[this->command_queue_head_].cmd));
+    this->command_queue_head_ = (this->command_queue_head_ + 1) % COMMAND_QUEUE_SIZE;
+    this->command_queue_count_--;
+  }
+  uint8_t tail = (this->command_queue_head_ + this->command_queue_count_) % COMMAND_QUEUE_SIZE;
+  TuyaCommand &slot = this->command_queue_[tail];
+  slot.cmd = command.cmd;
+  slot.payload.assign(command.payload.begin(), command.payload.end());
+  this->command_queue_count_++;
+  this->process_command_queue_();
 }
 
 void Tuya::send_empty_command_(TuyaCommandType command) {
@@ -5,6 +5,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/components/uart/uart.h"
 
+#include <array>
+
 #ifdef USE_TIME
 #include "esphome/components/time/real_time_clock.h"
 #endif
@@ -106,9 +108,11 @@ class Tuya : public Component, public uart::UARTDevice {
   bool validate_message_();
 
   void handle_command_(uint8_t command, uint8_t version, const uint8_t *buffer, size_t len);
-  void send_raw_command_(TuyaCommand command);
+  void send_raw_command_(const TuyaCommand &command);
   void process_command_queue_();
   void send_command_(const TuyaCommand &command);
+  /// Find the position (from the head of the queue) of the queued write to this datapoint, or -1 if there is none.
+  int find_queued_datapoint_command_(uint8_t datapoint_id);
   void send_empty_command_(TuyaCommandType command);
   void set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, uint32_t value,
                                     uint8_t length, bool forced);
@@ -132,7 +136,11 @@ class Tuya : public Component, public uart::UARTDevice {
   std::vector<TuyaDatapoint> datapoints_;
   std::vector<uint8_t> rx_message_;
   std::vector<uint8_t> ignore_mcu_update_on_datapoints_{};
-  std::vector<TuyaCommand> command_queue_;
+  /// Ring buffer of pending commands, the payload vectors of the slots are reused.
+  static const uint8_t COMMAND_QUEUE_SIZE = 16;
+  std::array<TuyaCommand, COMMAND_QUEUE_SIZE> command_queue_{};
+  uint8_t command_queue_head_ = 0;
+  uint8_t command_queue_count_ = 0;
   optional<TuyaCommandType> expected_response_{};
   uint8_t wifi_status_ = -1;
   CallbackManager<void()> initialized_callback_{};
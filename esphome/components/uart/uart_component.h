@@ -48,6 +48,8 @@ class UARTComponent {
   virtual int available() = 0;
   /// Block until all bytes have been written to the UART bus.
   virtual void flush() = 0;
+  /// Change the baud rate of the running UART, returns false if this isn't supported.
+  virtual bool change_baud_rate(uint32_t baud_rate) { return false; }
 
   void set_tx_pin(InternalGPIOPin *tx_pin) { this->tx_pin_ = tx_pin; }
   void set_rx_pin(InternalGPIOPin *rx_pin) { this->rx_pin_ = rx_pin; }
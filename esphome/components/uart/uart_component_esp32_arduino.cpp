@@ -151,6 +151,12 @@ void ESP32ArduinoUARTComponent::flush() {
   this->hw_serial_->flush();
 }
 
+bool ESP32ArduinoUARTComponent::change_baud_rate(uint32_t baud_rate) {
+  this->hw_serial_->updateBaudRate(baud_rate);
+  this->baud_rate_ = baud_rate;
+  return true;
+}
+
 void ESP32ArduinoUARTComponent::check_logger_conflict() {
 #ifdef USE_LOGGER
   if (this->hw_serial_ == nullptr || logger::global_logger->get_baud_rate() == 0) {
@@ -25,6 +25,7 @@ class ESP32ArduinoUARTComponent : public UARTComponent, public Component {
 
   int available() override;
   void flush() override;
+  bool change_baud_rate(uint32_t baud_rate) override;
 
   uint32_t get_config();
 
@@ -184,6 +184,14 @@ void ESP8266UartComponent::flush() {
     this->sw_serial_->flush();
   }
 }
+bool ESP8266UartComponent::change_baud_rate(uint32_t baud_rate) {
+  // The software serial times its bits while receiving, changing that at runtime isn't supported
+  if (this->hw_serial_ == nullptr)
+    return false;
+  this->hw_serial_->updateBaudRate(baud_rate);
+  this->baud_rate_ = baud_rate;
+  return true;
+}
 void ESP8266SoftwareSerial::setup(InternalGPIOPin *tx_pin, InternalGPIOPin *rx_pin, uint32_t baud_rate,
                                   uint8_t stop_bits, uint32_t data_bits, UARTParityOptions parity,
                                   size_t rx_buffer_size) {
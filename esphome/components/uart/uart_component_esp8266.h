@@ -60,6 +60,7 @@ class ESP8266UartComponent : public UARTComponent, public Component {
 
   int available() override;
   void flush() override;
+  bool change_baud_rate(uint32_t baud_rate) override;
 
   uint32_t get_config();
 
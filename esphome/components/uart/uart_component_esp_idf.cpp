@@ -198,6 +198,18 @@ void IDFUARTComponent::flush() {
   xSemaphoreGive(this->lock_);
 }
 
+bool IDFUARTComponent::change_baud_rate(uint32_t baud_rate) {
+  xSemaphoreTake(this->lock_, portMAX_DELAY);
+  esp_err_t err = uart_set_baudrate(this->uart_num_, baud_rate);
+  xSemaphoreGive(this->lock_);
+  if (err != ESP_OK) {
+    ESP_LOGW(TAG, "uart_set_baudrate failed: %s", esp_err_to_name(err));
+    return false;
+  }
+  this->baud_rate_ = baud_rate;
+  return true;
+}
+
 void IDFUARTComponent::check_logger_conflict() {}
 
 }  // namespace uart
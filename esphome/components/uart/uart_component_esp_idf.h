@@ -22,6 +22,7 @@ class IDFUARTComponent : public UARTComponent, public Component {
 
   int available() override;
   void flush() override;
+  bool change_baud_rate(uint32_t baud_rate) override;
 
  protected:
   void check_logger_conflict() override;
@@ -13,6 +13,7 @@ from esphome.const import (
 )
 
 CONF_PULSE_TIME = "pulse_time"
+CONF_BURST_COUNT = "burst_count"
 
 ultrasonic_ns = cg.esphome_ns.namespace("ultrasonic")
 UltrasonicSensorComponent = ultrasonic_ns.class_(
@@ -35,6 +36,7 @@ CONFIG_SCHEMA = (
             cv.Optional(
                 CONF_PULSE_TIME, default="10us"
             ): cv.positive_time_period_microseconds,
+            cv.Optional(CONF_BURST_COUNT, default=1): cv.int_range(min=1, max=15),
         }
     )
     .extend(cv.polling_component_schema("60s"))
@@ -53,3 +55,4 @@ async def to_code(config):
 
     cg.add(var.set_timeout_us(config[CONF_TIMEOUT] / (0.000343 / 2)))
     cg.add(var.set_pulse_time_us(config[CONF_PULSE_TIME]))
+    cg.add(var.set_burst_count(config[CONF_BURST_COUNT]))
@@ -2,44 +2,105 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace ultrasonic {
 
 static const char *const TAG = "ultrasonic.sensor";
 
+// Time between the pings of a burst, HC-SR04 datasheet recommends 60ms for the echo to fade
+static const uint32_t BURST_PING_INTERVAL = 60;
+
+void IRAM_ATTR UltrasonicSensorStore::gpio_intr(UltrasonicSensorStore *arg) {
+  const uint32_t now = micros();
+  if (!arg->armed)
+    return;
+  if (arg->pin.digital_read()) {
+    // Only the first rising edge starts the echo, later ones would make echo_start > echo_end
+    if (!arg->echo_started) {
+      arg->echo_start = now;
+      arg->echo_started = true;
+    }
+  } else if (arg->echo_started) {
+    arg->echo_end = now;
+    arg->echo_done = true;
+    arg->armed = false;
+  }
+}
+void UltrasonicSensorStore::reset() {
+  // Disarm while clearing, so an edge in between can't leave a half reset state behind
+  this->armed = false;
+  this->echo_started = false;
+  this->echo_done = false;
+  this->armed = true;
+}
+
 void UltrasonicSensorComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Ultrasonic Sensor...");
   this->trigger_pin_->setup();
   this->trigger_pin_->digital_write(false);
   this->echo_pin_->setup();
-  // isr is faster to access
-  echo_isr_ = echo_pin_->to_isr();
+  this->store_.pin = this->echo_pin_->to_isr();
+  this->echo_pin_->attach_interrupt(UltrasonicSensorStore::gpio_intr, &this->store_, gpio::INTERRUPT_ANY_EDGE);
+  this->samples_.reserve(this->burst_count_);
 }
 void UltrasonicSensorComponent::update() {
+  if (this->waiting_ || !this->samples_.empty()) {
+    ESP_LOGV(TAG, "'%s' - Previous measurement still running", this->name_.c_str());
+    return;
+  }
+  this->send_ping_();
+}
+void UltrasonicSensorComponent::send_ping_() {
+  this->store_.reset();
   this->trigger_pin_->digital_write(true);
   delayMicroseconds(this->pulse_time_us_);
   this->trigger_pin_->digital_write(false);
+  this->ping_time_ = micros();
+  this->waiting_ = true;
+}
+void UltrasonicSensorComponent::loop() {
+  if (!this->waiting_)
+    return;
 
-  const uint32_t start = micros();
-  while (micros() - start < timeout_us_ && echo_isr_.digital_read())
-    ;
-  while (micros() - start < timeout_us_ && !echo_isr_.digital_read())
-    ;
-  const uint32_t pulse_start = micros();
-  while (micros() - start < timeout_us_ && echo_isr_.digital_read())
-    ;
-  const uint32_t pulse_end = micros();
+  uint32_t duration = 0;
+  if (this->store_.echo_done) {
+    if (this->store_.echo_end - this->ping_time_ < this->timeout_us_) {
+      duration = this->store_.echo_end - this->store_.echo_start;
+      ESP_LOGV(TAG, "Echo took %uµs", duration);
+    }
+  } else if (micros() - this->ping_time_ < this->timeout_us_) {
+    return;
+  }
+  this->store_.armed = false;
+  this->waiting_ = false;
+  this->samples_.push_back(duration);
 
-  ESP_LOGV(TAG, "Echo took %uµs", pulse_end - pulse_start);
+  if (this->samples_.size() < this->burst_count_) {
+    // Let the echo of the previous ping die down before sending the next one
+    this->set_timeout("ping", BURST_PING_INTERVAL, [this]() { this->send_ping_(); });
+    return;
+  }
+  this->publish_burst_();
+}
+void UltrasonicSensorComponent::publish_burst_() {
+  std::vector<uint32_t> valid;
+  for (uint32_t duration : this->samples_) {
+    if (duration != 0)
+      valid.push_back(duration);
+  }
+  this->samples_.clear();
 
-  if (pulse_end - start >= timeout_us_) {
+  if (valid.empty()) {
     ESP_LOGD(TAG, "'%s' - Distance measurement timed out!", this->name_.c_str());
     this->publish_state(NAN);
-  } else {
-    float result = UltrasonicSensorComponent::us_to_m(pulse_end - pulse_start);
-    ESP_LOGD(TAG, "'%s' - Got distance: %.2f m", this->name_.c_str(), result);
-    this->publish_state(result);
+    return;
   }
+  std::sort(valid.begin(), valid.end());
+  float result = UltrasonicSensorComponent::us_to_m(valid[valid.size() / 2]);
+  ESP_LOGD(TAG, "'%s' - Got distance: %.2f m", this->name_.c_str(), result);
+  this->publish_state(result);
 }
 void UltrasonicSensorComponent::dump_config() {
   LOG_SENSOR("", "Ultrasonic Sensor", this);
@@ -47,6 +108,9 @@ void UltrasonicSensorComponent::dump_config() {
   LOG_PIN("  Trigger Pin: ", this->trigger_pin_);
   ESP_LOGCONFIG(TAG, "  Pulse time: %u µs", this->pulse_time_us_);
   ESP_LOGCONFIG(TAG, "  Timeout: %u µs", this->timeout_us_);
+  if (this->burst_count_ > 1) {
+    ESP_LOGCONFIG(TAG, "  Burst: median of %u pings", this->burst_count_);
+  }
   LOG_UPDATE_INTERVAL(this);
 }
 float UltrasonicSensorComponent::us_to_m(uint32_t us) {
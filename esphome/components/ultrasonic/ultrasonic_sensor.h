@@ -4,9 +4,26 @@
 #include "esphome/core/gpio.h"
 #include "esphome/components/sensor/sensor.h"
 
+#include <vector>
+
 namespace esphome {
 namespace ultrasonic {
 
+/// Echo edges captured by the interrupt, read back in loop().
+struct UltrasonicSensorStore {
+  ISRInternalGPIOPin pin;
+  volatile uint32_t echo_start{0};
+  volatile uint32_t echo_end{0};
+  /// Only set between a ping and its echo or timeout, edges outside of that window are ignored
+  volatile bool armed{false};
+  volatile bool echo_started{false};
+  volatile bool echo_done{false};
+
+  /// Forget the previous echo and wait for the one of a new ping.
+  void reset();
+  static void gpio_intr(UltrasonicSensorStore *arg);
+};
+
 class UltrasonicSensorComponent : public sensor::Sensor, public PollingComponent {
  public:
   void set_trigger_pin(GPIOPin *trigger_pin) { trigger_pin_ = trigger_pin; }
@@ -14,6 +31,8 @@ class UltrasonicSensorComponent : public sensor::Sensor, public PollingComponent
 
   /// Set the timeout for waiting for the echo in µs.
   void set_timeout_us(uint32_t timeout_us);
+  /// Number of pings per update, the median distance of them is published.
+  void set_burst_count(uint8_t burst_count) { burst_count_ = burst_count; }
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -22,6 +41,7 @@ class UltrasonicSensorComponent : public sensor::Sensor, public PollingComponent
   void dump_config() override;
 
   void update() override;
+  void loop() override;
 
   float get_setup_priority() const override;
 
@@ -33,11 +53,21 @@ class UltrasonicSensorComponent : public sensor::Sensor, public PollingComponent
   static float us_to_m(uint32_t us);
   /// Helper function to convert the specified distance in meters to the echo duration in µs.
 
+  /// Send a trigger pulse, the echo is collected in loop().
+  void send_ping_();
+  void publish_burst_();
+
   GPIOPin *trigger_pin_;
   InternalGPIOPin *echo_pin_;
-  ISRInternalGPIOPin echo_isr_;
+  UltrasonicSensorStore store_;
   uint32_t timeout_us_{};  /// 2 meters.
   uint32_t pulse_time_us_{};
+  uint8_t burst_count_{1};
+  /// micros() at the end of the trigger pulse, only valid while waiting_
+  uint32_t ping_time_{0};
+  bool waiting_{false};
+  /// Echo durations in µs of the current burst, 0 for timed out pings
+  std::vector<uint32_t> samples_;
 };
 
 }  // namespace ultrasonic
@@ -1,3 +1,7 @@
+import gzip
+import hashlib
+import io
+
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import web_server_base
@@ -22,6 +26,9 @@ AUTO_LOAD = ["json", "web_server_base"]
 web_server_ns = cg.esphome_ns.namespace("web_server")
 WebServer = web_server_ns.class_("WebServer", cg.Component, cg.Controller)
 
+CONF_CSS_INCLUDE_DATA_ID = "css_include_data_id"
+CONF_JS_INCLUDE_DATA_ID = "js_include_data_id"
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -31,10 +38,12 @@ CONFIG_SCHEMA = cv.All(
                 CONF_CSS_URL, default="https://esphome.io/_static/webserver-v1.min.css"
             ): cv.string,
             cv.Optional(CONF_CSS_INCLUDE): cv.file_,
+            cv.GenerateID(CONF_CSS_INCLUDE_DATA_ID): cv.declare_id(cg.uint8),
             cv.Optional(
                 CONF_JS_URL, default="https://esphome.io/_static/webserver-v1.min.js"
             ): cv.string,
             cv.Optional(CONF_JS_INCLUDE): cv.file_,
+            cv.GenerateID(CONF_JS_INCLUDE_DATA_ID): cv.declare_id(cg.uint8),
             cv.Optional(CONF_AUTH): cv.Schema(
                 {
                     cv.Required(CONF_USERNAME): cv.All(
@@ -56,6 +65,27 @@ CONFIG_SCHEMA = cv.All(
 )
 
 
+def gzip_include(path):
+    """Compress an included file for serving it with Content-Encoding: gzip.
+
+    Returns the compressed bytes and a strong ETag derived from the content.
+    """
+    with open(file=path, mode="rb") as myfile:
+        data = myfile.read()
+    buf = io.BytesIO()
+    # Fixed mtime so unchanged includes produce identical firmware
+    with gzip.GzipFile(fileobj=buf, mode="wb", compresslevel=9, mtime=0) as gz_file:
+        gz_file.write(data)
+    etag = f'"{hashlib.sha256(data).hexdigest()[:16]}"'
+    return buf.getvalue(), etag
+
+
+def include_to_code(var, setter, data_id, path):
+    data, etag = gzip_include(CORE.relative_config_path(path))
+    arr = cg.progmem_array(data_id, list(data))
+    cg.add(getattr(var, setter)(arr, len(data), etag))
+
+
 @coroutine_with_priority(40.0)
 async def to_code(config):
     paren = await cg.get_variable(config[CONF_WEB_SERVER_BASE_ID])
@@ -76,12 +106,18 @@ async def to_code(config):
         cg.add(paren.set_auth_password(config[CONF_AUTH][CONF_PASSWORD]))
     if CONF_CSS_INCLUDE in config:
         cg.add_define("WEBSERVER_CSS_INCLUDE")
-        path = CORE.relative_config_path(config[CONF_CSS_INCLUDE])
-        with open(file=path, mode="r", encoding="utf-8") as myfile:
-            cg.add(var.set_css_include(myfile.read()))
+        include_to_code(
+            var,
+            "set_css_include",
+            config[CONF_CSS_INCLUDE_DATA_ID],
+            config[CONF_CSS_INCLUDE],
+        )
     if CONF_JS_INCLUDE in config:
         cg.add_define("WEBSERVER_JS_INCLUDE")
-        path = CORE.relative_config_path(config[CONF_JS_INCLUDE])
-        with open(file=path, mode="r", encoding="utf-8") as myfile:
-            cg.add(var.set_js_include(myfile.read()))
+        include_to_code(
+            var,
+            "set_js_include",
+            config[CONF_JS_INCLUDE_DATA_ID],
+            config[CONF_JS_INCLUDE],
+        )
     cg.add(var.set_include_internal(config[CONF_INCLUDE_INTERNAL]))
@@ -77,9 +77,13 @@ UrlMatch match_url(const std::string &url, bool only_domain = false) {
 }
 
 void WebServer::set_css_url(const char *css_url) { this->css_url_ = css_url; }
-void WebServer::set_css_include(const char *css_include) { this->css_include_ = css_include; }
+void WebServer::set_css_include(const uint8_t *data, size_t length, const char *etag) {
+  this->css_include_ = {data, length, etag};
+}
 void WebServer::set_js_url(const char *js_url) { this->js_url_ = js_url; }
-void WebServer::set_js_include(const char *js_include) { this->js_include_ = js_include; }
+void WebServer::set_js_include(const uint8_t *data, size_t length, const char *etag) {
+  this->js_include_ = {data, length, etag};
+}
 
 void WebServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up web server...");
@@ -297,7 +301,7 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
   stream->print(F("<h2>Debug Log</h2><pre id=\"log\"></pre>"));
 
 #ifdef WEBSERVER_JS_INCLUDE
-  if (this->js_include_ != nullptr) {
+  if (this->js_include_.data != nullptr) {
     stream->print(F("<script src=\"/0.js\"></script>"));
   }
 #endif
@@ -311,25 +315,36 @@ void WebServer::handle_index_request(AsyncWebServerRequest *request) {
   request->send(stream);
 }
 
-#ifdef WEBSERVER_CSS_INCLUDE
-void WebServer::handle_css_request(AsyncWebServerRequest *request) {
-  AsyncResponseStream *stream = request->beginResponseStream("text/css");
-  if (this->css_include_ != nullptr) {
-    stream->print(this->css_include_);
+#if defined(WEBSERVER_CSS_INCLUDE) || defined(WEBSERVER_JS_INCLUDE)
+void WebServer::send_asset_(AsyncWebServerRequest *request, const WebServerAsset &asset, const char *content_type) {
+  if (asset.data == nullptr) {
+    request->send(404);
+    return;
   }
+  // The content only changes with the firmware, revalidation just compares the tag
+  AsyncWebHeader *if_none_match = request->getHeader("If-None-Match");
+  if (if_none_match != nullptr && if_none_match->value() == asset.etag) {
+    request->send(304);
+    return;
+  }
+  // Streamed straight from flash, without copying the (already compressed) file into RAM
+  AsyncWebServerResponse *response = request->beginResponse_P(200, content_type, asset.data, asset.length);
+  response->addHeader("Content-Encoding", "gzip");
+  response->addHeader("ETag", asset.etag);
+  response->addHeader("Cache-Control", "no-cache");
+  request->send(response);
+}
+#endif
 
-  request->send(stream);
+#ifdef WEBSERVER_CSS_INCLUDE
+void WebServer::handle_css_request(AsyncWebServerRequest *request) {
+  this->send_asset_(request, this->css_include_, "text/css");
 }
 #endif
 
 #ifdef WEBSERVER_JS_INCLUDE
 void WebServer::handle_js_request(AsyncWebServerRequest *request) {
-  AsyncResponseStream *stream = request->beginResponseStream("text/javascript");
-  if (this->js_include_ != nullptr) {
-    stream->print(this->js_include_);
-  }
-
-  request->send(stream);
+  this->send_asset_(request, this->js_include_, "text/javascript");
 }
 #endif
 
@@ -768,13 +783,18 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
     return true;
 
 #ifdef WEBSERVER_CSS_INCLUDE
-  if (request->url() == "/0.css")
+  if (request->url() == "/0.css") {
+    // Headers that aren't requested here are dropped before handleRequest
+    request->addInterestingHeader("If-None-Match");
     return true;
+  }
 #endif
 
 #ifdef WEBSERVER_JS_INCLUDE
-  if (request->url() == "/0.js")
+  if (request->url() == "/0.js") {
+    request->addInterestingHeader("If-None-Match");
     return true;
+  }
 #endif
 
   UrlMatch match = match_url(request->url().c_str(), true);
@@ -19,6 +19,13 @@ struct UrlMatch {
   bool valid;          ///< Whether this match is valid
 };
 
+/// A static file stored gzip compressed in flash
+struct WebServerAsset {
+  const uint8_t *data{nullptr};
+  size_t length{0};
+  const char *etag{nullptr};  ///< Quoted entity tag derived from the content at compile time
+};
+
 /** This class allows users to create a web server with their ESP nodes.
  *
  * Behind the scenes it's using AsyncWebServer to set up the server. It exposes 3 things:
@@ -39,11 +46,13 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    */
   void set_css_url(const char *css_url);
 
-  /** Set local path to the script that's embedded in the index page. Defaults to
+  /** Set the gzip compressed stylesheet that's served under '/0.css'.
    *
-   * @param css_include Local path to web server script.
+   * @param data Compressed stylesheet in flash.
+   * @param length Size of data in bytes.
+   * @param etag Quoted entity tag identifying the content.
    */
-  void set_css_include(const char *css_include);
+  void set_css_include(const uint8_t *data, size_t length, const char *etag);
 
   /** Set the URL to the script that's embedded in the index page. Defaults to
    * https://esphome.io/_static/webserver-v1.min.js
@@ -52,11 +61,13 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
    */
   void set_js_url(const char *js_url);
 
-  /** Set local path to the script that's embedded in the index page. Defaults to
+  /** Set the gzip compressed script that's served under '/0.js'.
    *
-   * @param js_include Local path to web server script.
+   * @param data Compressed script in flash.
+   * @param length Size of data in bytes.
+   * @param etag Quoted entity tag identifying the content.
    */
-  void set_js_include(const char *js_include);
+  void set_js_include(const uint8_t *data, size_t length, const char *etag);
 
   /** Determine whether internal components should be displayed on the web server.
    * Defaults to false.
@@ -193,12 +204,15 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   bool isRequestHandlerTrivial() override;
 
  protected:
+  /// Send a compressed asset, or 304 Not Modified when the browser already has this version.
+  void send_asset_(AsyncWebServerRequest *request, const WebServerAsset &asset, const char *content_type);
+
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
   const char *css_url_{nullptr};
-  const char *css_include_{nullptr};
+  WebServerAsset css_include_{};
   const char *js_url_{nullptr};
-  const char *js_include_{nullptr};
+  WebServerAsset js_include_{};
   bool include_internal_{false};
   bool allow_ota_{true};
 };
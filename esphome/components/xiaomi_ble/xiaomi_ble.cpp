@@ -5,7 +5,6 @@
 #ifdef USE_ESP32
 
 #include <vector>
-#include "mbedtls/ccm.h"
 
 namespace esphome {
 namespace xiaomi_ble {
@@ -218,9 +217,43 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
 }
 
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address) {
+  XiaomiDecryptor decryptor;
+  if (!decryptor.set_bindkey(bindkey))
+    return false;
+  return decryptor.decrypt(raw, address);
+}
+
+void XiaomiDecryptor::set_bindkey(const std::string &bindkey) {
+  uint8_t key[16] = {0};
+  if (bindkey.size() == 32) {
+    char temp[3] = {0};
+    for (int i = 0; i < 16; i++) {
+      strncpy(temp, &(bindkey.c_str()[i * 2]), 2);
+      key[i] = std::strtoul(temp, nullptr, 16);
+    }
+  }
+  this->set_bindkey(key);
+}
+
+bool XiaomiDecryptor::set_bindkey(const uint8_t *bindkey) {
+  memcpy(this->bindkey_, bindkey, sizeof(this->bindkey_));
+  int ret = mbedtls_ccm_setkey(&this->ctx_, MBEDTLS_CIPHER_ID_AES, this->bindkey_, sizeof(this->bindkey_) * 8);
+  this->has_key_ = ret == 0;
+  if (!this->has_key_) {
+    ESP_LOGVV(TAG, "XiaomiDecryptor::set_bindkey(): mbedtls_ccm_setkey() failed.");
+  }
+  return this->has_key_;
+}
+
+bool XiaomiDecryptor::decrypt(std::vector<uint8_t> &raw, const uint64_t &address) {
   if (!((raw.size() == 19) || ((raw.size() >= 22) && (raw.size() <= 24)))) {
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): data packet has wrong size (%d)!", raw.size());
     ESP_LOGVV(TAG, "  Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
+    this->rejected_++;
+    return false;
+  }
+  if (!this->has_key_) {
+    this->rejected_++;
     return false;
   }
 
@@ -232,6 +265,16 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
   mac_reverse[1] = (uint8_t)(address >> 8);
   mac_reverse[0] = (uint8_t)(address >> 0);
 
+  const uint8_t *v = raw.data();
+  int cipher_pos = (raw.size() == 19) ? 5 : 11;
+
+  // Frames with the MAC included (frame control bit 4) can be rejected before any crypto if it doesn't match
+  if (cipher_pos == 11 && (v[0] & 0x10) && memcmp(v + 5, mac_reverse, 6) != 0) {
+    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): MAC address in packet doesn't match.");
+    this->rejected_++;
+    return false;
+  }
+
   XiaomiAESVector vector{.key = {0},
                          .plaintext = {0},
                          .ciphertext = {0},
@@ -245,29 +288,16 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
                          .ivsize = 12};
 
   vector.datasize = (raw.size() == 19) ? raw.size() - 12 : raw.size() - 18;
-  int cipher_pos = (raw.size() == 19) ? 5 : 11;
 
-  const uint8_t *v = raw.data();
-
-  memcpy(vector.key, bindkey, vector.keysize);
   memcpy(vector.ciphertext, v + cipher_pos, vector.datasize);
   memcpy(vector.tag, v + raw.size() - vector.tagsize, vector.tagsize);
   memcpy(vector.iv, mac_reverse, 6);             // MAC address reverse
   memcpy(vector.iv + 6, v + 2, 3);               // sensor type (2) + packet id (1)
   memcpy(vector.iv + 9, v + raw.size() - 7, 3);  // payload counter
 
-  mbedtls_ccm_context ctx;
-  mbedtls_ccm_init(&ctx);
-
-  int ret = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, vector.key, vector.keysize * 8);
-  if (ret) {
-    ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): mbedtls_ccm_setkey() failed.");
-    mbedtls_ccm_free(&ctx);
-    return false;
-  }
-
-  ret = mbedtls_ccm_auth_decrypt(&ctx, vector.datasize, vector.iv, vector.ivsize, vector.authdata, vector.authsize,
-                                 vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
+  this->attempts_++;
+  int ret = mbedtls_ccm_auth_decrypt(&this->ctx_, vector.datasize, vector.iv, vector.ivsize, vector.authdata,
+                                     vector.authsize, vector.ciphertext, vector.plaintext, vector.tag, vector.tagsize);
   if (ret) {
     uint8_t mac_address[6] = {0};
     memcpy(mac_address, mac_reverse + 5, 1);
@@ -279,20 +309,17 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
     ESP_LOGVV(TAG, "decrypt_xiaomi_payload(): authenticated decryption failed.");
     ESP_LOGVV(TAG, "  MAC address : %s", format_hex_pretty(mac_address, 6).c_str());
     ESP_LOGVV(TAG, "       Packet : %s", format_hex_pretty(raw.data(), raw.size()).c_str());
-    ESP_LOGVV(TAG, "          Key : %s", format_hex_pretty(vector.key, vector.keysize).c_str());
+    ESP_LOGVV(TAG, "          Key : %s", format_hex_pretty(this->bindkey_, vector.keysize).c_str());
     ESP_LOGVV(TAG, "           Iv : %s", format_hex_pretty(vector.iv, vector.ivsize).c_str());
     ESP_LOGVV(TAG, "       Cipher : %s", format_hex_pretty(vector.ciphertext, vector.datasize).c_str());
     ESP_LOGVV(TAG, "          Tag : %s", format_hex_pretty(vector.tag, vector.tagsize).c_str());
-    mbedtls_ccm_free(&ctx);
+    ESP_LOGV(TAG, "Decryption failed, %u of %u attempts succeeded", this->successes_, this->attempts_);
     return false;
   }
+  this->successes_++;
 
   // replace encrypted payload with plaintext
-  uint8_t *p = vector.plaintext;
-  for (std::vector<uint8_t>::iterator it = raw.begin() + cipher_pos; it != raw.begin() + cipher_pos + vector.datasize;
-       ++it) {
-    *it = *(p++);
-  }
+  memcpy(raw.data() + cipher_pos, vector.plaintext, vector.datasize);
 
   // clear encrypted flag
   raw[0] &= ~0x08;
@@ -301,10 +328,15 @@ bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, c
   ESP_LOGVV(TAG, "  Plaintext : %s, Packet : %d", format_hex_pretty(raw.data() + cipher_pos, vector.datasize).c_str(),
             static_cast<int>(raw[4]));
 
-  mbedtls_ccm_free(&ctx);
   return true;
 }
 
+void XiaomiDecryptor::dump_config(const char *tag) const {
+  ESP_LOGCONFIG(tag, "  Bindkey: %s", format_hex_pretty(this->bindkey_, 16).c_str());
+  ESP_LOGCONFIG(tag, "  Decryption: %u/%u succeeded, %u rejected early", this->successes_, this->attempts_,
+                this->rejected_);
+}
+
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address) {
   if (!result.has_value()) {
     ESP_LOGVV(TAG, "report_xiaomi_results(): no results available.");
@@ -5,6 +5,8 @@
 
 #ifdef USE_ESP32
 
+#include "mbedtls/ccm.h"
+
 namespace esphome {
 namespace xiaomi_ble {
 
@@ -67,6 +69,40 @@ optional<XiaomiParseResult> parse_xiaomi_header(const esp32_ble_tracker::Service
 bool decrypt_xiaomi_payload(std::vector<uint8_t> &raw, const uint8_t *bindkey, const uint64_t &address);
 bool report_xiaomi_results(const optional<XiaomiParseResult> &result, const std::string &address);
 
+/// AES-CCM context for a single bindkey.
+///
+/// The key expansion is done once in set_bindkey() instead of for every received advertisement.
+class XiaomiDecryptor {
+ public:
+  XiaomiDecryptor() { mbedtls_ccm_init(&this->ctx_); }
+  ~XiaomiDecryptor() { mbedtls_ccm_free(&this->ctx_); }
+  XiaomiDecryptor(const XiaomiDecryptor &) = delete;
+  XiaomiDecryptor &operator=(const XiaomiDecryptor &) = delete;
+
+  /// Parse a 32 character hex bindkey and prepare the cipher context.
+  void set_bindkey(const std::string &bindkey);
+  bool set_bindkey(const uint8_t *bindkey);
+  const uint8_t *get_bindkey() const { return this->bindkey_; }
+
+  /// Decrypt the payload of raw in place for the device with the given address.
+  bool decrypt(std::vector<uint8_t> &raw, const uint64_t &address);
+
+  uint32_t get_attempts() const { return this->attempts_; }
+  uint32_t get_successes() const { return this->successes_; }
+  uint32_t get_rejected() const { return this->rejected_; }
+  void dump_config(const char *tag) const;
+
+ protected:
+  mbedtls_ccm_context ctx_;
+  uint8_t bindkey_[16]{0};
+  bool has_key_{false};
+  /// Packets that went through authenticated decryption.
+  uint32_t attempts_{0};
+  uint32_t successes_{0};
+  /// Packets dropped before any crypto (wrong size or embedded MAC mismatch).
+  uint32_t rejected_{0};
+};
+
 class XiaomiListener : public esp32_ble_tracker::ESPBTDeviceListener {
  public:
   bool parse_device(const esp32_ble_tracker::ESPBTDevice &device) override;
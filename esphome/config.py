@@ -3,6 +3,7 @@ import functools
 import heapq
 import logging
 import re
+import time
 
 # pylint: disable=unused-import, wrong-import-order
 from contextlib import contextmanager
@@ -23,7 +24,7 @@ from esphome.core import CORE, EsphomeError
 from esphome.helpers import indent
 from esphome.util import safe_print, OrderedDict
 
-from typing import List, Optional, Tuple, Union
+from typing import Dict, List, Optional, Tuple, Union
 from esphome.loader import get_component, get_platform, ComponentManifest
 from esphome.yaml_util import is_secret, ESPHomeDataBase, ESPForceValue
 from esphome.voluptuous_schema import ExtraKeysInvalid
@@ -96,6 +97,8 @@ class Config(OrderedDict, fv.FinalValidateConfig):
         self._validation_tasks: List[_ValidationStepTask] = []
         # ID to ensure stable order for keys with equal priority
         self._validation_tasks_id = 0
+        # Seconds spent per validation phase/component, reported in verbose mode
+        self.timings: Dict[str, float] = {}
 
     def add_error(self, error):
         # type: (vol.Invalid) -> None
@@ -123,6 +126,16 @@ class Config(OrderedDict, fv.FinalValidateConfig):
             task = heapq.heappop(self._validation_tasks)
             task.step.run(self)
 
+    @contextmanager
+    def timed(self, name):
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self.timings[name] = (
+                self.timings.get(name, 0.0) + time.perf_counter() - start
+            )
+
     @contextmanager
     def catch_error(self, path=None):
         path = path or []
@@ -472,6 +485,7 @@ class SchemaValidationStep(ConfigValidationStep):
     def __init__(
         self, domain: str, path: ConfigPath, conf: ConfigType, comp: ComponentManifest
     ):
+        self.domain = domain
         self.path = path
         self.conf = conf
         self.comp = comp
@@ -479,7 +493,7 @@ class SchemaValidationStep(ConfigValidationStep):
     def run(self, result: Config) -> None:
         if self.comp.config_schema is None:
             return
-        with result.catch_error(self.path):
+        with result.timed(self.domain), result.catch_error(self.path):
             if self.comp.is_platform:
                 # Remove 'platform' key for validation
                 input_conf = OrderedDict(self.conf)
@@ -641,7 +655,7 @@ class FinalValidateValidationStep(ConfigValidationStep):
         token = fv.full_config.set(result)
 
         conf = result.get_nested_item(self.path)
-        with result.catch_error(self.path):
+        with result.timed("final_validate"), result.catch_error(self.path):
             self.comp.final_validate_schema(conf)
 
         fv.full_config.reset(token)
@@ -659,7 +673,8 @@ def validate_config(config, command_line_substitutions):
 
         result.add_output_path([CONF_PACKAGES], CONF_PACKAGES)
         try:
-            config = do_packages_pass(config)
+            with result.timed(CONF_PACKAGES):
+                config = do_packages_pass(config)
         except vol.Invalid as err:
             result.update(config)
             result.add_error(err)
@@ -677,7 +692,8 @@ def validate_config(config, command_line_substitutions):
         }
         result.add_output_path([CONF_SUBSTITUTIONS], CONF_SUBSTITUTIONS)
         try:
-            substitutions.do_substitution_pass(config, command_line_substitutions)
+            with result.timed(CONF_SUBSTITUTIONS):
+                substitutions.do_substitution_pass(config, command_line_substitutions)
         except vol.Invalid as err:
             result.add_error(err)
             return result
@@ -746,6 +762,22 @@ def validate_config(config, command_line_substitutions):
     return result
 
 
+def _log_timings(result: Config, load_time: float):
+    stats = yaml_util.YAML_CACHE_STATS
+    _LOGGER.debug(
+        "Loaded YAML in %.3fs (%d files parsed, %d reused from cache)",
+        load_time,
+        stats["misses"],
+        stats["hits"],
+    )
+    total = sum(result.timings.values())
+    _LOGGER.debug("Validation timing (%.3fs total):", total)
+    for name, seconds in sorted(
+        result.timings.items(), key=lambda x: x[1], reverse=True
+    ):
+        _LOGGER.debug("  %-30s %8.1fms", name, seconds * 1000)
+
+
 def humanize_error(config, validation_error):
     validation_error = str(validation_error)
     m = re.match(
@@ -808,10 +840,12 @@ class InvalidYAMLError(EsphomeError):
 
 
 def _load_config(command_line_substitutions):
+    start = time.perf_counter()
     try:
         config = yaml_util.load_yaml(CORE.config_path)
     except EsphomeError as e:
         raise InvalidYAMLError(e) from e
+    load_time = time.perf_counter() - start
 
     try:
         result = validate_config(config, command_line_substitutions)
@@ -821,6 +855,8 @@ def _load_config(command_line_substitutions):
         _LOGGER.error("Unexpected exception while reading configuration:")
         raise
 
+    if CORE.verbose:
+        _log_timings(result, load_time)
     return result
 
 
@@ -746,6 +746,7 @@ CONF_Y_GRID = "y_grid"
 CONF_ZERO = "zero"
 
 ENV_NOGITIGNORE = "ESPHOME_NOGITIGNORE"
+ENV_NOBUILDCACHE = "ESPHOME_NO_BUILD_CACHE"
 ENV_QUICKWIZARD = "ESPHOME_QUICKWIZARD"
 
 ICON_ACCELERATION = "mdi:axis-arrow"
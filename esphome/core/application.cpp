@@ -11,6 +11,9 @@ namespace esphome {
 
 static const char *const TAG = "app";
 
+/// Components taking at least this long (in ms) to set up are listed in the config dump.
+static const uint32_t SLOW_SETUP_THRESHOLD = 100;
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -27,39 +30,70 @@ void Application::register_component_(Component *comp) {
 }
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()...");
+  const uint32_t setup_start = millis();
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
   });
 
+  auto by_loop_priority = [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); };
+  // Components that are set up and have to keep running while waiting for a later one, by loop priority. Inserting
+  // each at its position keeps the order without sorting again.
+  std::vector<Component *> running;
+  // Set up components that had to be waited for are moved into loop priority order at the end
+  uint32_t loop_sorted_end = 0;
+
   for (uint32_t i = 0; i < this->components_.size(); i++) {
     Component *component = this->components_[i];
+    const uint32_t start = millis();
 
     component->call();
     this->scheduler.process_to_add();
     this->feed_wdt();
-    if (component->can_proceed())
-      continue;
-
-    std::stable_sort(this->components_.begin(), this->components_.begin() + i + 1,
-                     [](Component *a, Component *b) { return a->get_loop_priority() > b->get_loop_priority(); });
-
-    do {
-      uint32_t new_app_state = STATUS_LED_WARNING;
-      this->scheduler.call();
-      this->feed_wdt();
-      for (uint32_t j = 0; j <= i; j++) {
-        this->components_[j]->call();
-        new_app_state |= this->components_[j]->get_component_state();
-        this->app_state_ |= new_app_state;
+    if (component->has_overridden_loop()) {
+      running.insert(std::upper_bound(running.begin(), running.end(), component, by_loop_priority), component);
+    }
+
+    bool timed_out = false;
+    if (!component->can_proceed()) {
+      loop_sorted_end = i + 1;
+      ESP_LOGV(TAG, "Waiting for %s to be ready...", component->get_component_source());
+
+      do {
+        uint32_t new_app_state = STATUS_LED_WARNING;
+        this->scheduler.call();
         this->feed_wdt();
-      }
-      this->app_state_ = new_app_state;
-      yield();
-    } while (!component->can_proceed());
+        for (auto *running_component : running) {
+          running_component->call();
+          this->feed_wdt();
+        }
+        for (uint32_t j = 0; j <= i; j++) {
+          new_app_state |= this->components_[j]->get_component_state();
+        }
+        this->app_state_ = new_app_state;
+
+        const uint32_t now = millis();
+        if (this->setup_timeout_ != 0 && now - start > this->setup_timeout_ && !component->can_proceed()) {
+          ESP_LOGE(TAG, "%s isn't ready after %u ms, continuing setup without it", component->get_component_source(),
+                   now - start);
+          component->status_set_warning();
+          timed_out = true;
+          break;
+        }
+        this->delay_next_loop_(now);
+      } while (!component->can_proceed());
+    }
+
+    const uint32_t duration = millis() - start;
+    ESP_LOGV(TAG, "Setup of %s took %u ms", component->get_component_source(), duration);
+    if (duration >= SLOW_SETUP_THRESHOLD || timed_out)
+      this->slow_setups_.push_back({component, duration, timed_out});
   }
 
-  ESP_LOGI(TAG, "setup() finished successfully!");
+  std::stable_sort(this->components_.begin(), this->components_.begin() + loop_sorted_end, by_loop_priority);
+
+  this->setup_duration_ = millis() - setup_start;
+  ESP_LOGI(TAG, "setup() finished successfully after %u ms!", this->setup_duration_);
   this->schedule_dump_config();
   this->calculate_looping_components_();
 }
@@ -79,8 +113,23 @@ void Application::loop() {
   }
   this->app_state_ = new_app_state;
 
-  const uint32_t now = millis();
+  this->delay_next_loop_(millis());
+
+  if (this->dump_config_at_ < this->components_.size()) {
+    if (this->dump_config_at_ == 0) {
+      ESP_LOGI(TAG, "ESPHome version " ESPHOME_VERSION " compiled on %s", this->compilation_time_.c_str());
+#ifdef ESPHOME_PROJECT_NAME
+      ESP_LOGI(TAG, "Project " ESPHOME_PROJECT_NAME " version " ESPHOME_PROJECT_VERSION);
+#endif
+      this->dump_setup_timings_();
+    }
 
+    this->components_[this->dump_config_at_]->call_dump_config();
+    this->dump_config_at_++;
+  }
+}
+
+void Application::delay_next_loop_(uint32_t now) {
   if (HighFrequencyLoopRequester::is_high_frequency()) {
     yield();
   } else {
@@ -96,17 +145,17 @@ void Application::loop() {
     delay(delay_time);
   }
   this->last_loop_ = now;
+}
 
-  if (this->dump_config_at_ < this->components_.size()) {
-    if (this->dump_config_at_ == 0) {
-      ESP_LOGI(TAG, "ESPHome version " ESPHOME_VERSION " compiled on %s", this->compilation_time_.c_str());
-#ifdef ESPHOME_PROJECT_NAME
-      ESP_LOGI(TAG, "Project " ESPHOME_PROJECT_NAME " version " ESPHOME_PROJECT_VERSION);
-#endif
+void Application::dump_setup_timings_() {
+  ESP_LOGCONFIG(TAG, "Setup took %u ms", this->setup_duration_);
+  for (auto &timing : this->slow_setups_) {
+    if (timing.timed_out) {
+      ESP_LOGW(TAG, "  %s: not ready after %u ms, skipped", timing.component->get_component_source(),
+               timing.duration);
+    } else {
+      ESP_LOGCONFIG(TAG, "  %s: %u ms", timing.component->get_component_source(), timing.duration);
     }
-
-    this->components_[this->dump_config_at_]->call_dump_config();
-    this->dump_config_at_++;
   }
 }
 
@@ -139,6 +139,18 @@ class Application {
    */
   void set_loop_interval(uint32_t loop_interval) { this->loop_interval_ = loop_interval; }
 
+  /** Set how long setup() waits for a component that can't proceed yet.
+   *
+   * When the timeout expires, the component is flagged with a warning and setup continues with the next component,
+   * the blocked one keeps running in the main loop. 0 (the default) waits forever.
+   *
+   * @param setup_timeout The timeout in milliseconds.
+   */
+  void set_setup_timeout(uint32_t setup_timeout) { this->setup_timeout_ = setup_timeout; }
+
+  /// Time in milliseconds from the start of setup() until all components were set up.
+  uint32_t get_setup_duration() const { return this->setup_duration_; }
+
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
   void feed_wdt();
@@ -267,11 +279,24 @@ class Application {
 
   void calculate_looping_components_();
 
+  /// Sleep until the next loop iteration is due, like loop() does after calling all components.
+  void delay_next_loop_(uint32_t now);
+
+  void dump_setup_timings_();
+
   void feed_wdt_arch_();
 
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
+  struct SetupTiming {
+    Component *component;
+    uint32_t duration;
+    bool timed_out;
+  };
+  /// Components that were slow to set up, printed with the config dump.
+  std::vector<SetupTiming> slow_setups_{};
+
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
 #endif
@@ -311,6 +336,8 @@ class Application {
   bool name_add_mac_suffix_;
   uint32_t last_loop_{0};
   uint32_t loop_interval_{16};
+  uint32_t setup_timeout_{0};
+  uint32_t setup_duration_{0};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
 };
@@ -97,6 +97,7 @@ def valid_project_name(value: str):
 
 
 CONF_ESP8266_RESTORE_FROM_FLASH = "esp8266_restore_from_flash"
+CONF_SETUP_TIMEOUT = "setup_timeout"
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
@@ -127,6 +128,8 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+            # Continue setup when a component isn't ready after this time
+            cv.Optional(CONF_SETUP_TIMEOUT): cv.positive_time_period_milliseconds,
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -317,6 +320,9 @@ async def to_code(config):
         )
     )
 
+    if CONF_SETUP_TIMEOUT in config:
+        cg.add(cg.App.set_setup_timeout(config[CONF_SETUP_TIMEOUT]))
+
     CORE.add_job(_add_automations, config)
 
     cg.add_build_flag("-fno-exceptions")
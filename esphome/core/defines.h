@@ -21,6 +21,7 @@
 #define USE_BUTTON
 #define USE_CLIMATE
 #define USE_COVER
+#define USE_DALLAS_UART
 #define USE_DEEP_SLEEP
 #define USE_FAN
 #define USE_GRAPH
@@ -497,6 +497,29 @@ template<typename T> class Parented {
   T *parent_{nullptr};
 };
 
+/// Running sum of many small values that keeps its precision when the total grows large (Kahan summation).
+class CompensatedSum {
+ public:
+  /// Add \p value to the sum.
+  void add(double value) {
+    const double y = value - this->compensation_;
+    const double t = this->sum_ + y;
+    this->compensation_ = (t - this->sum_) - y;
+    this->sum_ = t;
+  }
+  /// Reset the sum to \p value.
+  void reset(double value = 0.0) {
+    this->sum_ = value;
+    this->compensation_ = 0.0;
+  }
+  /// Get the current sum.
+  double value() const { return this->sum_; }
+
+ protected:
+  double sum_{0.0};
+  double compensation_{0.0};
+};
+
 /// @}
 
 /// @name System APIs
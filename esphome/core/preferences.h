@@ -2,7 +2,10 @@
 
 #include <cstring>
 #include <cstdint>
+#include <functional>
+#include <utility>
 
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -11,6 +14,8 @@ class ESPPreferenceBackend {
  public:
   virtual bool save(const uint8_t *data, size_t len) = 0;
   virtual bool load(uint8_t *data, size_t len) = 0;
+  /// Whether save() stores the data right away instead of buffering it until the next sync().
+  virtual bool is_written_immediately() const { return false; }
 };
 
 class ESPPreferenceObject {
@@ -30,6 +35,8 @@ class ESPPreferenceObject {
     return backend_->load(reinterpret_cast<uint8_t *>(dest), sizeof(T));
   }
 
+  bool is_written_immediately() const { return backend_ != nullptr && backend_->is_written_immediately(); }
+
  protected:
   ESPPreferenceBackend *backend_{nullptr};
 };
@@ -46,6 +53,21 @@ class ESPPreferences {
    */
   virtual bool sync() = 0;
 
+  /** Register a callback that saves the latest state of a component right before pending writes are committed.
+   *
+   * This lets frequently changing values (like energy counters) be persisted once per sync instead of on every
+   * update. The argument is true when the device is about to shut down.
+   */
+  void add_on_snapshot_callback(std::function<void(bool)> &&callback) {
+    this->snapshot_callback_.add(std::move(callback));
+  }
+
+  /// Collect the state of all snapshot callbacks and commit everything to flash in one go.
+  bool snapshot_and_sync(bool shutdown) {
+    this->snapshot_callback_.call(shutdown);
+    return this->sync();
+  }
+
   template<typename T, enable_if_t<is_trivially_copyable<T>::value, bool> = true>
   ESPPreferenceObject make_preference(uint32_t type, bool in_flash) {
     return this->make_preference(sizeof(T), type, in_flash);
@@ -55,8 +77,57 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(uint32_t type) {
     return this->make_preference(sizeof(T), type);
   }
+
+ protected:
+  CallbackManager<void(bool)> snapshot_callback_;
 };
 
 extern ESPPreferences *global_preferences;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
+/** Persist a frequently changing value, like an energy counter, without a flash write on every change.
+ *
+ * Preferences that are written immediately (ESP8266 RTC memory) and all preferences without a minimum save interval
+ * are saved on every update(), which keeps the value across crashes. Otherwise the latest value is saved right before
+ * the preferences are synced. The interval only throttles periodic saves, the latest value is always kept on shutdown.
+ */
+template<typename T> class ThrottledPreference {
+ public:
+  /// Load the stored value into value, returns false if there was none. Later updates are persisted from then on.
+  bool setup(ESPPreferenceObject pref, uint32_t min_save_interval, T *value) {
+    this->pref_ = pref;
+    this->min_save_interval_ = min_save_interval;
+    const bool loaded = this->pref_.load(value);
+    this->value_ = *value;
+    this->saved_value_ = *value;
+    this->last_save_ = millis();
+    global_preferences->add_on_snapshot_callback([this](bool shutdown) { this->save_(shutdown); });
+    return loaded;
+  }
+
+  void update(const T &value) {
+    this->value_ = value;
+    if (this->min_save_interval_ == 0 || this->pref_.is_written_immediately())
+      this->save_(true);
+  }
+
+ protected:
+  /// Save the latest value if it changed, force skips the minimum save interval.
+  void save_(bool force) {
+    if (this->value_ == this->saved_value_)
+      return;
+    const uint32_t now = millis();
+    if (!force && now - this->last_save_ < this->min_save_interval_)
+      return;
+    this->last_save_ = now;
+    this->saved_value_ = this->value_;
+    this->pref_.save(&this->saved_value_);
+  }
+
+  ESPPreferenceObject pref_;
+  T value_{};
+  T saved_value_{};
+  uint32_t min_save_interval_{0};
+  uint32_t last_save_{0};
+};
+
 }  // namespace esphome
@@ -1,19 +1,19 @@
 # pylint: disable=wrong-import-position
 
 import codecs
-import collections
+from concurrent.futures import ThreadPoolExecutor, as_completed
 import functools
 import hashlib
 import hmac
 import json
 import logging
-import multiprocessing
 import os
 from pathlib import Path
 import secrets
 import shutil
 import subprocess
 import threading
+import time
 
 import tornado
 import tornado.concurrent
@@ -37,6 +37,7 @@ from esphome.storage_json import (
     trash_storage_path,
 )
 from esphome.util import shlex_quote, get_serial_ports
+from .status import DeviceStatusStore, ProbeScheduler, probe_device
 from .util import password_hash
 
 # pylint: disable=unused-import, wrong-import-order
@@ -620,37 +621,27 @@ class MainRequestHandler(BaseHandler):
         )
 
 
-def _ping_func(filename, address):
-    if os.name == "nt":
-        command = ["ping", "-n", "1", address]
-    else:
-        command = ["ping", "-c", "1", address]
-    rc, _, _ = run_system_command(*command)
-    return filename, rc == 0
-
-
 class MDNSStatusThread(threading.Thread):
     def run(self):
         global IMPORT_RESULT
 
         zc = EsphomeZeroconf()
-
-        def on_update(dat):
-            for key, b in dat.items():
-                PING_RESULT[key] = b
-
-        stat = DashboardStatus(zc, on_update)
+        stat = DashboardStatus(zc, STATUS.update)
         imports = DashboardImportDiscovery(zc)
 
         stat.start()
         while not STOP_EVENT.is_set():
             entries = _list_dashboard_entries()
+            STATUS.remove_missing(entry.filename for entry in entries)
             stat.request_query(
                 {entry.filename: f"{entry.name}.local." for entry in entries}
             )
             IMPORT_RESULT = imports.import_state
+            STATUS.metrics.mdns_queries = stat.queries_sent
 
-            PING_REQUEST.wait()
+            # Device changes are pushed by the status thread, only refresh the
+            # list of configurations here
+            PING_REQUEST.wait(ENTRIES_REFRESH_INTERVAL)
             PING_REQUEST.clear()
 
         stat.stop()
@@ -661,53 +652,106 @@ class MDNSStatusThread(threading.Thread):
 
 class PingStatusThread(threading.Thread):
     def run(self):
-        with multiprocessing.Pool(processes=8) as pool:
-            while not STOP_EVENT.wait(2):
-                # Only do pings if somebody has the dashboard open
-
-                def callback(ret):
-                    PING_RESULT[ret[0]] = ret[1]
-
-                entries = _list_dashboard_entries()
-                queue = collections.deque()
-                for entry in entries:
-                    if entry.address is None:
-                        PING_RESULT[entry.filename] = None
-                        continue
-
-                    result = pool.apply_async(
-                        _ping_func, (entry.filename, entry.address), callback=callback
+        scheduler = ProbeScheduler()
+        entries = []
+        entries_loaded = 0.0
+        with ThreadPoolExecutor(max_workers=8) as executor:
+            while not STOP_EVENT.is_set():
+                now = time.monotonic()
+                if now - entries_loaded > ENTRIES_REFRESH_INTERVAL:
+                    entries = _list_dashboard_entries()
+                    entries_loaded = now
+                    STATUS.remove_missing(entry.filename for entry in entries)
+                    STATUS.update(
+                        {
+                            entry.filename: None
+                            for entry in entries
+                            if entry.address is None
+                        }
                     )
-                    queue.append(result)
-
-                while queue:
-                    item = queue[0]
-                    if item.ready():
-                        queue.popleft()
-                        continue
-
-                    try:
-                        item.get(0.1)
-                    except OSError:
-                        # ping not installed
-                        pass
-                    except multiprocessing.TimeoutError:
-                        pass
-
-                    if STOP_EVENT.is_set():
-                        pool.terminate()
-                        return
-
-                PING_REQUEST.wait()
+
+                # Only do pings if somebody has the dashboard open
+                if STATUS.has_interest:
+                    by_key = {
+                        entry.filename: entry
+                        for entry in entries
+                        if entry.address is not None
+                    }
+                    futures = [
+                        executor.submit(
+                            probe_device,
+                            key,
+                            by_key[key].address,
+                            "api" in by_key[key].loaded_integrations,
+                        )
+                        for key in scheduler.due(list(by_key), now)
+                    ]
+                    for future in as_completed(futures):
+                        key, online, duration = future.result()
+                        scheduler.report(key, online, time.monotonic())
+                        STATUS.metrics.record_probe(online, duration)
+                        STATUS.update({key: online})
+                    STATUS.metrics.last_cycle_duration = time.monotonic() - now
+                    now = time.monotonic()
+                    timeout = scheduler.next_wakeup(now) - now
+                else:
+                    timeout = None
+
+                PING_REQUEST.wait(
+                    ENTRIES_REFRESH_INTERVAL
+                    if timeout is None
+                    else max(0.5, min(timeout, ENTRIES_REFRESH_INTERVAL))
+                )
                 PING_REQUEST.clear()
 
 
 class PingRequestHandler(BaseHandler):
     @authenticated
     def get(self):
+        STATUS.touch()
         PING_REQUEST.set()
         self.set_header("content-type", "application/json")
-        self.write(json.dumps(PING_RESULT))
+        self.write(json.dumps(STATUS.snapshot()))
+
+
+class StatusMetricsRequestHandler(BaseHandler):
+    @authenticated
+    def get(self):
+        self.set_header("content-type", "application/json")
+        self.write(json.dumps(STATUS.metrics.as_dict()))
+
+
+# pylint: disable=abstract-method, arguments-differ
+class StatusWebSocket(tornado.websocket.WebSocketHandler):
+    """Pushes device online status changes instead of having the UI poll /ping."""
+
+    def __init__(self, application, request, **kwargs):
+        super().__init__(application, request, **kwargs)
+        self._loop = tornado.ioloop.IOLoop.current()
+
+    def open(self):
+        if not is_authenticated(self):
+            self.close(code=4001, reason="Not authenticated")
+            return
+        self.write_message({"event": "initial", "data": STATUS.snapshot()})
+        STATUS.add_listener(self._on_change)
+        PING_REQUEST.set()
+
+    def _on_change(self, changed):
+        # Called from the status threads
+        self._loop.add_callback(self._send_update, changed)
+
+    def _send_update(self, changed):
+        try:
+            self.write_message({"event": "update", "data": changed})
+        except tornado.websocket.WebSocketClosedError:
+            pass
+
+    def on_close(self):
+        try:
+            STATUS.remove_listener(self._on_change)
+        except ValueError:
+            pass
 
 
 class InfoRequestHandler(BaseHandler):
@@ -775,8 +819,10 @@ class UndoDeleteRequestHandler(BaseHandler):
         shutil.move(os.path.join(trash_path, configuration), config_file)
 
 
-PING_RESULT = {}  # type: dict
+STATUS = DeviceStatusStore()
 IMPORT_RESULT = {}
+# Interval in seconds to re-read the list of configurations for status tracking
+ENTRIES_REFRESH_INTERVAL = 10.0
 STOP_EVENT = threading.Event()
 PING_REQUEST = threading.Event()
 
@@ -914,7 +960,10 @@ def make_app(debug=get_bool_env(ENV_DEV)):
 
             if isinstance(handler, SerialPortRequestHandler) and not debug:
                 return
-            if isinstance(handler, PingRequestHandler) and not debug:
+            if (
+                isinstance(handler, (PingRequestHandler, StatusMetricsRequestHandler))
+                and not debug
+            ):
                 return
         elif handler.get_status() < 500:
             log_method = access_log.warning
@@ -964,6 +1013,8 @@ def make_app(debug=get_bool_env(ENV_DEV)):
             (f"{rel}manifest.json", ManifestRequestHandler),
             (f"{rel}serial-ports", SerialPortRequestHandler),
             (f"{rel}ping", PingRequestHandler),
+            (f"{rel}status", StatusWebSocket),
+            (f"{rel}status-metrics", StatusMetricsRequestHandler),
             (f"{rel}delete", DeleteRequestHandler),
             (f"{rel}undo-delete", UndoDeleteRequestHandler),
             (f"{rel}wizard", WizardRequestHandler),
@@ -0,0 +1,175 @@
+"""Device online status tracking for the dashboard.
+
+Status sources (ICMP/native API probes or mDNS) report results into a single
+DeviceStatusStore, which notifies websocket subscribers about changes only. Probes
+are scheduled per device with exponential backoff for offline devices, so large
+installations don't re-check every device on every refresh.
+"""
+import logging
+import os
+import socket
+import threading
+import time
+from typing import Callable, Dict, List, Optional, Tuple
+
+from esphome.helpers import run_system_command
+
+_LOGGER = logging.getLogger(__name__)
+
+# Re-check interval for devices that answered the last probe
+ONLINE_INTERVAL = 10.0
+# First retry delay for offline devices, doubled on every failed probe
+OFFLINE_INITIAL_INTERVAL = 5.0
+OFFLINE_MAX_INTERVAL = 120.0
+# Stop probing when no client has shown interest for this long
+INTEREST_TIMEOUT = 30.0
+API_PORT = 6053
+PROBE_TIMEOUT = 2.0
+
+
+class StatusMetrics:
+    def __init__(self):
+        self.probes = 0
+        self.probe_failures = 0
+        self.probe_time = 0.0
+        self.mdns_queries = 0
+        self.updates_pushed = 0
+        self.last_cycle_duration = 0.0
+
+    def record_probe(self, online: bool, duration: float) -> None:
+        self.probes += 1
+        if not online:
+            self.probe_failures += 1
+        self.probe_time += duration
+
+    def as_dict(self) -> dict:
+        return {
+            "probes": self.probes,
+            "probe_failures": self.probe_failures,
+            "probe_time_total": round(self.probe_time, 3),
+            "probe_time_avg": round(self.probe_time / self.probes, 4)
+            if self.probes
+            else 0.0,
+            "mdns_queries": self.mdns_queries,
+            "updates_pushed": self.updates_pushed,
+            "last_cycle_duration": round(self.last_cycle_duration, 4),
+        }
+
+
+class DeviceStatusStore:
+    """Latest online state per configuration file, shared by all status sources."""
+
+    def __init__(self):
+        self._lock = threading.Lock()
+        self._state: Dict[str, Optional[bool]] = {}
+        self._listeners: List[Callable[[Dict[str, Optional[bool]]], None]] = []
+        self._last_interest = 0.0
+        self.metrics = StatusMetrics()
+
+    def update(self, results: Dict[str, Optional[bool]]) -> None:
+        with self._lock:
+            changed = {
+                key: value
+                for key, value in results.items()
+                if key not in self._state or self._state[key] != value
+            }
+            self._state.update(changed)
+            listeners = list(self._listeners)
+        if not changed:
+            return
+        for listener in listeners:
+            listener(changed)
+            self.metrics.updates_pushed += 1
+
+    def remove_missing(self, keys) -> None:
+        with self._lock:
+            for key in set(self._state) - set(keys):
+                del self._state[key]
+
+    def snapshot(self) -> Dict[str, Optional[bool]]:
+        with self._lock:
+            return dict(self._state)
+
+    def add_listener(self, listener) -> None:
+        with self._lock:
+            self._listeners.append(listener)
+        self.touch()
+
+    def remove_listener(self, listener) -> None:
+        with self._lock:
+            self._listeners.remove(listener)
+
+    def touch(self) -> None:
+        """Mark that a client is looking at the status."""
+        self._last_interest = time.monotonic()
+
+    @property
+    def has_interest(self) -> bool:
+        if self._listeners:
+            return True
+        return time.monotonic() - self._last_interest < INTEREST_TIMEOUT
+
+
+class ProbeScheduler:
+    """Decides which devices are due for a probe."""
+
+    def __init__(self):
+        # key -> (next probe time, current offline interval)
+        self._next: Dict[str, Tuple[float, float]] = {}
+
+    def due(self, keys, now: float) -> List[str]:
+        for key in set(self._next) - set(keys):
+            del self._next[key]
+        return [
+            key for key in keys if key not in self._next or self._next[key][0] <= now
+        ]
+
+    def report(self, key: str, online: bool, now: float) -> None:
+        if online:
+            self._next[key] = (now + ONLINE_INTERVAL, OFFLINE_INITIAL_INTERVAL)
+            return
+        _, interval = self._next.get(key, (now, OFFLINE_INITIAL_INTERVAL))
+        self._next[key] = (now + interval, min(interval * 2, OFFLINE_MAX_INTERVAL))
+
+    def next_wakeup(self, now: float) -> float:
+        if not self._next:
+            return now + ONLINE_INTERVAL
+        return min(next_ for next_, _ in self._next.values())
+
+
+def _probe_api(address: str, port: int) -> bool:
+    try:
+        with socket.create_connection((address, port), timeout=PROBE_TIMEOUT):
+            return True
+    except ConnectionRefusedError:
+        # The host answered, just not on the API port
+        return True
+    except OSError:
+        return False
+
+
+def _probe_ping(address: str) -> bool:
+    if os.name == "nt":
+        command = ["ping", "-n", "1", address]
+    else:
+        command = ["ping", "-c", "1", address]
+    rc, _, _ = run_system_command(*command)
+    return rc == 0
+
+
+def probe_device(key: str, address: str, use_api: bool) -> Tuple[str, bool, float]:
+    """Check a single device.
+
+    Devices with the native API get a TCP connect, which avoids spawning a ping
+    process per probe.
+    """
+    start = time.monotonic()
+    if use_api:
+        online = _probe_api(address, API_PORT)
+    else:
+        try:
+            online = _probe_ping(address)
+        except OSError:
+            # ping not installed
+            online = False
+    return key, online, time.monotonic() - start
@@ -8,8 +8,9 @@ import os
 import re
 import subprocess
 
-from esphome.const import KEY_CORE
+from esphome.const import ENV_NOBUILDCACHE, KEY_CORE
 from esphome.core import CORE, EsphomeError
+from esphome.helpers import get_bool_env
 from esphome.util import run_external_command, run_external_process
 
 _LOGGER = logging.getLogger(__name__)
@@ -80,6 +81,18 @@ def run_platformio_cli(*args, **kwargs) -> Union[str, int]:
     os.environ.setdefault(
         "PLATFORMIO_LIBDEPS_DIR", os.path.abspath(CORE.relative_piolibdeps_path())
     )
+    if not get_bool_env(ENV_NOBUILDCACHE):
+        os.environ["ESPHOME_BUILD_CACHE_DIR"] = os.path.abspath(build_cache_dir())
+        os.environ["ESPHOME_BUILD_CACHE_STATS"] = os.path.abspath(
+            build_cache_stats_path()
+        )
+        os.environ["ESPHOME_BUILD_CACHE_BASE_DIRS"] = os.pathsep.join(
+            [
+                os.path.abspath(CORE.build_path),
+                os.path.abspath(CORE.relative_pioenvs_path()),
+                os.path.abspath(CORE.relative_piolibdeps_path()),
+            ]
+        )
     cmd = ["platformio"] + list(args)
 
     if not CORE.verbose:
@@ -102,8 +115,48 @@ def run_platformio_cli_run(config, verbose, *args, **kwargs) -> Union[str, int]:
     return run_platformio_cli(*command, **kwargs)
 
 
+# Upper bound for the shared object cache, least recently used entries are evicted
+BUILD_CACHE_MAX_SIZE = 2 * 1024 * 1024 * 1024
+
+
+def build_cache_dir():
+    return CORE.relative_internal_path("build_cache")
+
+
+def build_cache_stats_path():
+    return CORE.relative_pioenvs_path("build_cache_stats")
+
+
 def run_compile(config, verbose):
-    return run_platformio_cli_run(config, verbose)
+    from esphome import build_cache
+
+    use_cache = not get_bool_env(ENV_NOBUILDCACHE)
+    if use_cache:
+        build_cache.reset_stats(build_cache_stats_path())
+    rc = run_platformio_cli_run(config, verbose)
+    if use_cache:
+        _log_build_cache_stats()
+    return rc
+
+
+def _log_build_cache_stats():
+    from esphome import build_cache
+
+    stats = build_cache.read_stats(build_cache_stats_path())
+    total = stats["hits"] + stats["misses"]
+    if total == 0:
+        return
+    _LOGGER.info(
+        "Build cache: %d/%d objects reused (%.0f%%), %d compiled, %d uncacheable",
+        stats["hits"],
+        total,
+        100.0 * stats["hits"] / total,
+        stats["misses"],
+        stats["uncacheable"],
+    )
+    removed = build_cache.trim_cache(build_cache_dir(), BUILD_CACHE_MAX_SIZE)
+    if removed:
+        _LOGGER.info("Build cache: evicted %d old objects", removed)
 
 
 def _run_idedata(config):
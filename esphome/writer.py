@@ -9,6 +9,7 @@ from esphome.const import (
     HEADER_FILE_EXTENSIONS,
     SOURCE_FILE_EXTENSIONS,
     __version__,
+    ENV_NOBUILDCACHE,
     ENV_NOGITIGNORE,
 )
 from esphome.core import CORE, EsphomeError
@@ -141,6 +142,8 @@ def get_ini_content():
     )
     # Sort to avoid changing build flags order
     CORE.add_platformio_option("build_flags", sorted(CORE.build_flags))
+    if not get_bool_env(ENV_NOBUILDCACHE):
+        CORE.add_platformio_option("extra_scripts", ["pre:build_cache_hook.py"])
 
     content = f"[env:{CORE.name}]\n"
     content += format_ini(CORE.platformio_options)
@@ -197,9 +200,23 @@ def write_platformio_project():
     content = get_ini_content()
     if not get_bool_env(ENV_NOGITIGNORE):
         write_gitignore()
+    if not get_bool_env(ENV_NOBUILDCACHE):
+        write_build_cache_scripts()
     write_platformio_ini(content)
 
 
+def write_build_cache_scripts():
+    from esphome import build_cache
+
+    copy_file_if_changed(
+        os.path.join(os.path.dirname(__file__), "build_cache_hook.py.script"),
+        CORE.relative_build_path("build_cache_hook.py"),
+    )
+    copy_file_if_changed(
+        build_cache.__file__, CORE.relative_build_path("build_cache.py")
+    )
+
+
 DEFINES_H_FORMAT = ESPHOME_H_FORMAT = """\
 #pragma once
 #include "esphome/core/macros.h"
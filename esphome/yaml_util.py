@@ -1,9 +1,12 @@
+import copy
 import fnmatch
 import functools
+import hashlib
 import inspect
 import logging
 import math
 import os
+from typing import Dict, List, Optional, Tuple
 
 import uuid
 import yaml
@@ -32,6 +35,31 @@ _SECRET_CACHE = {}
 _SECRET_VALUES = {}
 
 
+class _CachedYAML:
+    """A parsed file together with everything it pulled in while loading."""
+
+    def __init__(self, digest: str):
+        self.digest = digest
+        # Path -> digest of included files (including secrets.yaml)
+        self.dependencies: Dict[str, str] = {}
+        # (value, name) pairs of !secret tags, replayed into _SECRET_VALUES on hits
+        self.secrets: List[Tuple[str, str]] = []
+        # Results depending on the environment or directory listings are not cached
+        self.cacheable = True
+        self.loads = 0
+        self.data = None
+
+
+# Parsed files keyed by absolute path, reused as long as the file and all its
+# dependencies are unchanged. Files are only kept after they have been loaded
+# twice (secrets.yaml, packages shared by several configurations in one run),
+# so single loads don't pay for the copy.
+_YAML_CACHE: Dict[str, _CachedYAML] = {}
+# Entries of the files currently being constructed, innermost last
+_LOADING_STACK: List[_CachedYAML] = []
+YAML_CACHE_STATS = {"hits": 0, "misses": 0}
+
+
 class ESPHomeDataBase:
     @property
     def esp_range(self):
@@ -221,6 +249,7 @@ class ESPHomeLoader(yaml.SafeLoader):  # pylint: disable=too-many-ancestors
 
     @_add_data_ref
     def construct_env_var(self, node):
+        _mark_uncacheable()
         args = node.value.split()
         # Check for a default value
         if len(args) > 1:
@@ -247,6 +276,8 @@ class ESPHomeLoader(yaml.SafeLoader):  # pylint: disable=too-many-ancestors
             )
         val = secrets[node.value]
         _SECRET_VALUES[str(val)] = node.value
+        for entry in _LOADING_STACK:
+            entry.secrets.append((str(val), node.value))
         return val
 
     @_add_data_ref
@@ -255,11 +286,13 @@ class ESPHomeLoader(yaml.SafeLoader):  # pylint: disable=too-many-ancestors
 
     @_add_data_ref
     def construct_include_dir_list(self, node):
+        _mark_uncacheable()
         files = filter_yaml_files(_find_files(self._rel_path(node.value), "*.yaml"))
         return [_load_yaml_internal(f) for f in files]
 
     @_add_data_ref
     def construct_include_dir_merge_list(self, node):
+        _mark_uncacheable()
         files = filter_yaml_files(_find_files(self._rel_path(node.value), "*.yaml"))
         merged_list = []
         for fname in files:
@@ -270,6 +303,7 @@ class ESPHomeLoader(yaml.SafeLoader):  # pylint: disable=too-many-ancestors
 
     @_add_data_ref
     def construct_include_dir_named(self, node):
+        _mark_uncacheable()
         files = filter_yaml_files(_find_files(self._rel_path(node.value), "*.yaml"))
         mapping = OrderedDict()
         for fname in files:
@@ -279,6 +313,7 @@ class ESPHomeLoader(yaml.SafeLoader):  # pylint: disable=too-many-ancestors
 
     @_add_data_ref
     def construct_include_dir_merge_named(self, node):
+        _mark_uncacheable()
         files = filter_yaml_files(_find_files(self._rel_path(node.value), "*.yaml"))
         mapping = OrderedDict()
         for fname in files:
@@ -336,16 +371,74 @@ def load_yaml(fname, clear_secrets=True):
     return _load_yaml_internal(fname)
 
 
+def _mark_uncacheable():
+    for entry in _LOADING_STACK:
+        entry.cacheable = False
+
+
+def _file_digest(content: str) -> str:
+    return hashlib.sha256(content.encode("utf-8", "surrogateescape")).hexdigest()
+
+
+def _cache_lookup(path: str, digest: str) -> Optional[_CachedYAML]:
+    entry = _YAML_CACHE.get(path)
+    if entry is None or entry.digest != digest or not entry.cacheable:
+        return None
+    for dep_path, dep_digest in entry.dependencies.items():
+        try:
+            if _file_digest(read_config_file(dep_path)) != dep_digest:
+                return None
+        except EsphomeError:
+            return None
+    return entry
+
+
+def _record_dependency(path: str, entry: _CachedYAML) -> None:
+    for parent in _LOADING_STACK:
+        parent.dependencies[path] = entry.digest
+        parent.dependencies.update(entry.dependencies)
+        parent.secrets.extend(entry.secrets)
+        parent.cacheable = parent.cacheable and entry.cacheable
+
+
+def clear_yaml_cache():
+    _YAML_CACHE.clear()
+
+
 def _load_yaml_internal(fname):
     content = read_config_file(fname)
+    path = os.path.abspath(fname)
+    digest = _file_digest(content)
+
+    entry = _cache_lookup(path, digest)
+    if entry is not None and entry.data is not None:
+        YAML_CACHE_STATS["hits"] += 1
+        for val, name in entry.secrets:
+            _SECRET_VALUES[val] = name
+        _record_dependency(path, entry)
+        return copy.deepcopy(entry.data)
+    YAML_CACHE_STATS["misses"] += 1
+
+    loads = entry.loads if entry is not None else 0
+    entry = _CachedYAML(digest)
+    entry.loads = loads + 1
+    _LOADING_STACK.append(entry)
     loader = ESPHomeLoader(content)
     loader.name = fname
     try:
-        return loader.get_single_data() or OrderedDict()
+        data = loader.get_single_data() or OrderedDict()
     except yaml.YAMLError as exc:
         raise EsphomeError(exc) from exc
     finally:
         loader.dispose()
+        _LOADING_STACK.pop()
+
+    if entry.cacheable:
+        if entry.loads > 1:
+            entry.data = copy.deepcopy(data)
+        _YAML_CACHE[path] = entry
+    _record_dependency(path, entry)
+    return data
 
 
 def dump(dict_):
@@ -1,7 +1,7 @@
 import socket
 import threading
 import time
-from typing import Dict, Optional
+from typing import Dict, Optional, Tuple
 import logging
 from dataclasses import dataclass
 
@@ -63,21 +63,28 @@ class HostResolver(RecordUpdateListener):
         return True
 
 
-class DashboardStatus(threading.Thread):
+class DashboardStatus(RecordUpdateListener, threading.Thread):
     PING_AFTER = 15 * 1000  # Send new mDNS request after 15 seconds
     OFFLINE_AFTER = PING_AFTER * 2  # Offline if no mDNS response after 30 seconds
+    # Queries to hosts that don't answer are backed off up to this interval
+    MAX_QUERY_INTERVAL = 5 * 60 * 1000
+    # Re-evaluate expiry of cache entries at least this often (in seconds)
+    CHECK_INTERVAL = 5.0
 
     def __init__(self, zc: Zeroconf, on_update) -> None:
         threading.Thread.__init__(self)
         self.zc = zc
         self.query_hosts: set[str] = set()
         self.key_to_host: Dict[str, str] = {}
+        # host -> (next query time, backoff interval)
+        self.query_backoff: Dict[str, Tuple[float, float]] = {}
+        self.queries_sent = 0
         self.stop_event = threading.Event()
         self.query_event = threading.Event()
         self.on_update = on_update
 
     def request_query(self, hosts: Dict[str, str]) -> None:
-        self.query_hosts = set(hosts.values())
+        self.query_hosts = {host.lower() for host in hosts.values()}
         self.key_to_host = hosts
         self.query_event.set()
 
@@ -85,6 +92,16 @@ class DashboardStatus(threading.Thread):
         self.stop_event.set()
         self.query_event.set()
 
+    def update_record(self, zc: Zeroconf, now: float, record: DNSRecord) -> None:
+        # Announcements and responses of tracked hosts wake up the status loop
+        # immediately instead of waiting for the next poll
+        if record is None or record.type != _TYPE_A:
+            return
+        name = record.name.lower()
+        if name in self.query_hosts:
+            self.query_backoff.pop(name, None)
+            self.query_event.set()
+
     def host_status(self, key: str) -> bool:
         entries = self.zc.cache.entries_with_name(key)
         if not entries:
@@ -95,23 +112,43 @@ class DashboardStatus(threading.Thread):
             (entry.created + DashboardStatus.OFFLINE_AFTER) >= now for entry in entries
         )
 
-    def run(self) -> None:
-        while not self.stop_event.is_set():
-            self.on_update(
-                {key: self.host_status(host) for key, host in self.key_to_host.items()}
+    def _send_queries(self) -> None:
+        now = current_time_millis()
+        for host in self.query_hosts:
+            entries = self.zc.cache.entries_with_name(host)
+            if entries and any(
+                (entry.created + DashboardStatus.PING_AFTER) > now for entry in entries
+            ):
+                continue
+            next_, interval = self.query_backoff.get(
+                host, (0, DashboardStatus.PING_AFTER)
             )
-            now = current_time_millis()
-            for host in self.query_hosts:
-                entries = self.zc.cache.entries_with_name(host)
-                if not entries or all(
-                    (entry.created + DashboardStatus.PING_AFTER) <= now
-                    for entry in entries
-                ):
-                    out = DNSOutgoing(_FLAGS_QR_QUERY)
-                    out.add_question(DNSQuestion(host, _TYPE_A, _CLASS_IN))
-                    self.zc.send(out)
-            self.query_event.wait()
-            self.query_event.clear()
+            if next_ > now:
+                continue
+            out = DNSOutgoing(_FLAGS_QR_QUERY)
+            out.add_question(DNSQuestion(host, _TYPE_A, _CLASS_IN))
+            self.zc.send(out)
+            self.queries_sent += 1
+            self.query_backoff[host] = (
+                now + interval,
+                min(interval * 2, DashboardStatus.MAX_QUERY_INTERVAL),
+            )
+
+    def run(self) -> None:
+        self.zc.add_listener(self, None)
+        try:
+            while not self.stop_event.is_set():
+                self.on_update(
+                    {
+                        key: self.host_status(host)
+                        for key, host in self.key_to_host.items()
+                    }
+                )
+                self._send_queries()
+                self.query_event.wait(DashboardStatus.CHECK_INTERVAL)
+                self.query_event.clear()
+        finally:
+            self.zc.remove_listener(self)
 
 
 ESPHOME_SERVICE_TYPE = "_esphomelib._tcp.local."
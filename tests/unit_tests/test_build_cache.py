@@ -0,0 +1,97 @@
+import pytest
+
+from esphome import build_cache
+
+
+@pytest.mark.parametrize(
+    "args, expected",
+    (
+        (
+            ["-o", "out/main.o", "-c", "-Os", "src/main.cpp"],
+            ("out/main.o", ["-E", "-Os", "src/main.cpp"]),
+        ),
+        (["-oout/main.o", "-c", "src/main.cpp"], ("out/main.o", ["-E", "src/main.cpp"])),
+        # Linking
+        (["-o", "firmware.elf", "main.o"], None),
+        # Extra outputs
+        (["-o", "main.o", "-c", "-MMD", "main.cpp"], None),
+        (["-c", "main.cpp"], None),
+    ),
+)
+def test_parse_compile_args(args, expected):
+    actual = build_cache.parse_compile_args(args)
+
+    assert actual == expected
+
+
+def test_compute_key__ignores_build_dir():
+    key_a = build_cache.compute_key(
+        "gcc",
+        ["-I/cfg/.esphome/build/a/src", "-c", "/cfg/.esphome/build/a/src/main.cpp"],
+        b'# 1 "/cfg/.esphome/build/a/src/main.cpp"\nint x;\n',
+        ["/cfg/.esphome/build/a"],
+    )
+    key_b = build_cache.compute_key(
+        "gcc",
+        ["-I/cfg/.esphome/build/b/src", "-c", "/cfg/.esphome/build/b/src/main.cpp"],
+        b'# 1 "/cfg/.esphome/build/b/src/main.cpp"\nint x;\n',
+        ["/cfg/.esphome/build/b"],
+    )
+
+    assert key_a == key_b
+
+
+def test_compute_key__ignores_output_path():
+    keys = []
+    for name in ("a", "b"):
+        output, preprocess_args = build_cache.parse_compile_args(
+            [
+                "-o",
+                f"/cfg/.esphome/build/{name}/.pioenvs/{name}/src/main.o",
+                "-c",
+                "-Os",
+                f"/cfg/.esphome/build/{name}/src/main.cpp",
+            ]
+        )
+        assert name in output
+        base_dirs = [f"/cfg/.esphome/build/{name}"]
+        keys.append(
+            build_cache.compute_key("gcc", preprocess_args, b"int x;", base_dirs)
+        )
+
+    assert keys[0] == keys[1]
+
+
+def test_compute_key__depends_on_flags_and_source():
+    base = build_cache.compute_key("gcc", ["-Os"], b"int x;", [])
+
+    assert base != build_cache.compute_key("gcc", ["-O2"], b"int x;", [])
+    assert base != build_cache.compute_key("gcc", ["-Os"], b"int y;", [])
+
+
+def test_stats_roundtrip(tmp_path):
+    stats = str(tmp_path / "stats")
+
+    build_cache.record_stat(stats, build_cache.STAT_HIT)
+    build_cache.record_stat(stats, build_cache.STAT_HIT)
+    build_cache.record_stat(stats, build_cache.STAT_MISS)
+
+    assert build_cache.read_stats(stats) == {
+        "hits": 2,
+        "misses": 1,
+        "uncacheable": 0,
+    }
+    build_cache.reset_stats(stats)
+    assert build_cache.read_stats(stats)["hits"] == 0
+
+
+def test_trim_cache(tmp_path):
+    for i in range(4):
+        entry = tmp_path / f"{i:02x}" / f"{i}.o"
+        entry.parent.mkdir()
+        entry.write_bytes(b"x" * 100)
+
+    removed = build_cache.trim_cache(str(tmp_path), 250)
+
+    assert removed == 2
+    assert len(list(tmp_path.glob("*/*.o"))) == 2
@@ -0,0 +1,92 @@
+import pytest
+
+from esphome.components.canbus.filters import (
+    FrameMatch,
+    mcp2515_filters,
+    twai_filter,
+)
+
+
+def _layout(can_id, extended):
+    # Standard ids occupy the upper 11 bits of an extended id
+    return can_id if extended else can_id << 18
+
+
+def _mcp2515_accepts(result, can_id, extended):
+    masks, filters = result
+    for num, (filter_id, filter_extended) in enumerate(filters):
+        mask = _layout(*masks[0 if num < 2 else 1])
+        if filter_extended != extended:
+            continue
+        if _layout(filter_id, extended) & mask == _layout(can_id, extended) & mask:
+            return True
+    return False
+
+
+@pytest.mark.parametrize(
+    "matches",
+    (
+        [FrameMatch(0x100, 0x7FF, False)],
+        [FrameMatch(0x100, 0x7FF, False), FrameMatch(0x200, 0x7FF, False)],
+        [FrameMatch(i, 0x7FF, False) for i in range(0x10, 0x1C)],
+        [FrameMatch(0x100, 0x700, False), FrameMatch(0x7FF, 0x7FF, False)],
+        [FrameMatch(0x18FEF100, 0x1FFFFFFF, True), FrameMatch(0x123, 0x7FF, False)],
+    ),
+)
+def test_mcp2515_filters__accept_all_wanted_frames(matches):
+    result = mcp2515_filters(matches)
+
+    masks, filters = result
+    assert len(masks) == 2
+    assert len(filters) == 6
+    for match in matches:
+        assert _mcp2515_accepts(result, match.can_id, match.extended)
+
+
+def test_mcp2515_filters__exact_ids_fit():
+    matches = [FrameMatch(can_id, 0x7FF, False) for can_id in (0x100, 0x200, 0x300)]
+
+    masks, filters = mcp2515_filters(matches)
+
+    assert masks == [(0x7FF, False), (0x7FF, False)]
+    assert {can_id for can_id, _ in filters} == {0x100, 0x200, 0x300}
+    assert not _mcp2515_accepts((masks, filters), 0x101, False)
+
+
+def test_mcp2515_filters__merges_when_out_of_slots():
+    matches = [FrameMatch(can_id, 0x7FF, False) for can_id in range(0x10, 0x1C)]
+
+    result = mcp2515_filters(matches)
+
+    # Twelve ids only fit the six filters if neighbours share one
+    assert result[0][0][0] == 0x7FE
+    assert not _mcp2515_accepts(result, 0x1C, False)
+
+
+def test_mcp2515_filters__falls_back_to_software():
+    assert mcp2515_filters([]) is None
+    assert mcp2515_filters([FrameMatch(0, 0, False)]) is None
+
+
+def test_twai_filter():
+    code, mask = twai_filter(
+        [FrameMatch(0x100, 0x7FF, False), FrameMatch(0x101, 0x7FF, False)]
+    )
+
+    assert code == 0x100 << 21
+    # Only the id bit that differs is "don't care" within the id field
+    assert (~mask >> 21) & 0x7FF == 0x7FE
+
+
+def test_twai_filter__extended():
+    code, mask = twai_filter([FrameMatch(0x18FEF100, 0x1FFFFFFF, True)])
+
+    assert code == 0x18FEF100 << 3
+    assert mask == 0x7
+
+
+def test_twai_filter__mixed_types_accept_all():
+    assert (
+        twai_filter([FrameMatch(0x100, 0x7FF, False), FrameMatch(0x100, 0x7FF, True)])
+        is None
+    )
@@ -0,0 +1,62 @@
+from esphome.dashboard import status
+
+
+def test_probe_scheduler__backoff_for_offline_devices():
+    scheduler = status.ProbeScheduler()
+
+    assert scheduler.due(["a", "b"], 0) == ["a", "b"]
+    scheduler.report("a", True, 0)
+    scheduler.report("b", False, 0)
+
+    assert scheduler.due(["a", "b"], 1) == []
+    assert scheduler.due(["a", "b"], status.OFFLINE_INITIAL_INTERVAL) == ["b"]
+
+    # Offline interval doubles on every failed probe up to the maximum
+    scheduler.due(["b"], 0)
+    now = 0.0
+    intervals = []
+    for _ in range(10):
+        scheduler.report("b", False, now)
+        next_ = scheduler.next_wakeup(now)
+        intervals.append(next_ - now)
+        now = next_
+    assert intervals[1] == 2 * intervals[0]
+    assert intervals[-1] == status.OFFLINE_MAX_INTERVAL
+
+
+def test_probe_scheduler__forgets_removed_devices():
+    scheduler = status.ProbeScheduler()
+    scheduler.report("a", False, 0)
+
+    assert scheduler.due([], 0) == []
+    assert scheduler.due(["a"], 0) == ["a"]
+
+
+def test_device_status_store__notifies_changes_only():
+    store = status.DeviceStatusStore()
+    received = []
+    store.add_listener(received.append)
+
+    store.update({"a.yaml": True, "b.yaml": False})
+    store.update({"a.yaml": True, "b.yaml": False})
+    store.update({"a.yaml": False, "b.yaml": False})
+
+    assert received == [{"a.yaml": True, "b.yaml": False}, {"a.yaml": False}]
+    assert store.metrics.updates_pushed == 2
+    assert store.snapshot() == {"a.yaml": False, "b.yaml": False}
+    assert store.has_interest
+
+    store.remove_missing(["b.yaml"])
+    assert store.snapshot() == {"b.yaml": False}
+
+
+def test_device_status_store__counts_pushes_per_listener():
+    store = status.DeviceStatusStore()
+
+    store.update({"a.yaml": True})
+    assert store.metrics.updates_pushed == 0
+
+    store.add_listener(lambda changed: None)
+    store.add_listener(lambda changed: None)
+    store.update({"a.yaml": False})
+    assert store.metrics.updates_pushed == 2
@@ -0,0 +1,25 @@
+import gzip
+
+from esphome.components.web_server import gzip_include
+
+
+def test_gzip_include__roundtrip(tmp_path):
+    path = tmp_path / "www.css"
+    path.write_bytes(b"body { color: red; }\n" * 50)
+
+    data, etag = gzip_include(str(path))
+
+    assert gzip.decompress(data) == path.read_bytes()
+    assert len(data) < len(path.read_bytes())
+    assert etag.startswith('"') and etag.endswith('"')
+
+
+def test_gzip_include__deterministic(tmp_path):
+    path = tmp_path / "www.js"
+    path.write_text("console.log('hi');")
+
+    first = gzip_include(str(path))
+    assert gzip_include(str(path)) == first
+
+    path.write_text("console.log('bye');")
+    assert gzip_include(str(path))[1] != first[1]
@@ -0,0 +1,48 @@
+from esphome import yaml_util
+
+
+def _write(path, text):
+    path.write_text(text, encoding="utf-8")
+    return str(path)
+
+
+def test_load_yaml__reuses_shared_files(tmp_path):
+    _write(tmp_path / "secrets.yaml", "password: hunter2\n")
+    _write(tmp_path / "package.yaml", "wifi:\n  password: !secret password\n")
+    config = _write(
+        tmp_path / "device.yaml",
+        "esphome:\n  name: device\npackages:\n  wifi: !include package.yaml\n",
+    )
+    yaml_util.clear_yaml_cache()
+
+    results = [yaml_util.load_yaml(config) for _ in range(3)]
+    hits = yaml_util.YAML_CACHE_STATS["hits"]
+    last = yaml_util.load_yaml(config)
+
+    assert yaml_util.YAML_CACHE_STATS["hits"] > hits
+    assert all(res == last for res in results)
+    assert last["packages"]["wifi"]["wifi"]["password"] == "hunter2"
+    # Secrets are still known for dumping when the file came from the cache
+    assert yaml_util.is_secret("hunter2") == "password"
+
+
+def test_load_yaml__cache_returns_copies(tmp_path):
+    config = _write(tmp_path / "device.yaml", "esphome:\n  name: device\n")
+    yaml_util.clear_yaml_cache()
+
+    for _ in range(3):
+        yaml_util.load_yaml(config)["esphome"]["name"] = "changed"
+
+    assert yaml_util.load_yaml(config)["esphome"]["name"] == "device"
+
+
+def test_load_yaml__invalidated_by_changed_include(tmp_path):
+    _write(tmp_path / "package.yaml", "value: 1\n")
+    config = _write(tmp_path / "device.yaml", "pkg: !include package.yaml\n")
+    yaml_util.clear_yaml_cache()
+
+    for _ in range(3):
+        assert yaml_util.load_yaml(config)["pkg"]["value"] == 1
+    _write(tmp_path / "package.yaml", "value: 2\n")
+
+    assert yaml_util.load_yaml(config)["pkg"]["value"] == 2